@@ -2,23 +2,150 @@
 
 #include "GMCExtendedLog.h"
 #include "GMCPawn.h"
+#include "Data/GMCE_SharedVariableSchema.h"
 #include "Interfaces/GMCE_SharedVariableComponent.h"
+#include "Misc/EngineVersionComparison.h"
+#include "UObject/UObjectIterator.h"
 
 #define POST_MOVEMENT_HANDLER(TypeName, Type) \
+	if ((bCollectChanges || OnShared##TypeName##Change.IsBound()) && \
+		SharedVariables_##TypeName.GatherChanges(SharedVariableGather)) \
 	{ \
-		TArray<FName> Names; \
-		SharedVariables_##TypeName.GenerateKeyArray(Names); \
-		for (auto& VariableName : Names) \
+		auto& Store = SharedVariables_##TypeName; \
+		const bool bBroadcastDynamic = OnShared##TypeName##Change.IsBound(); \
+		for (int32 Slot = Store.DirtySlots.Find(true); Slot != INDEX_NONE; Slot = Store.DirtySlots.FindFrom(true, Slot + 1)) \
 		{ \
-			const auto Variable = SharedVariables_##TypeName.Find(VariableName); \
-			if (Variable && Variable->WasUpdated()) \
+			Store.DirtySlots[Slot] = false; \
+			auto& Variable = Store.Variables[Slot]; \
+			if (!Variable.WasUpdated()) continue; \
+			if (bCollectChanges) \
 			{ \
-				OnShared##TypeName##Change.Broadcast(VariableName, Variable->CurrentValue, Variable->OldValue); \
-				Variable->OldValue = Variable->CurrentValue; \
+				FGMCE_SharedVariableChange& Change = PendingSharedVariableChanges.AddDefaulted_GetRef(); \
+				Change.Handle.Type = EGMCE_SharedVariableType::TypeName; \
+				Change.Handle.Slot = Slot; \
+				Change.VariableName = Variable.VariableName; \
+				Change.OldValue.Set<Type>(Variable.OldValue); \
+				Change.NewValue.Set<Type>(Variable.CurrentValue); \
 			} \
+			if (bBroadcastDynamic) \
+			{ \
+				const Type PreviousValue = Variable.OldValue; \
+				Variable.OldValue = Variable.CurrentValue; \
+				OnShared##TypeName##Change.Broadcast(Variable.VariableName, Variable.CurrentValue, PreviousValue); \
+			} \
+			else \
+			{ \
+				Variable.OldValue = Variable.CurrentValue; \
+			} \
+		} \
+	}
+
+#define FIND_SHARED_VARIABLE_HANDLE(TypeName) \
+	case EGMCE_SharedVariableType::TypeName: \
+		if (const int32 Slot = SharedVariables_##TypeName.FindSlot(VariableName); Slot != INDEX_NONE) \
+		{ \
+			Handle.Type = EGMCE_SharedVariableType::TypeName; \
+			Handle.Slot = Slot; \
 		} \
+		break;
+
+#define RESERVE_SCHEMA_VARIABLES(TypeName) \
+	WasEmpty[static_cast<int32>(EGMCE_SharedVariableType::TypeName)] = SharedVariables_##TypeName.Num() == 0; \
+	SharedVariables_##TypeName.Reserve(SharedVariables_##TypeName.Num() + Counts[static_cast<int32>(EGMCE_SharedVariableType::TypeName)]);
+
+#define APPLY_SCHEMA_DEFINITION(TypeName) \
+	case EGMCE_SharedVariableType::TypeName: \
+	{ \
+		MakeShared##TypeName(Definition.VariableName, \
+			SharedVariableSchema->GetParsedDefaultValue<TGMCE_SharedVariableTraits<EGMCE_SharedVariableType::TypeName>::ValueType>(Index), \
+			Definition.PredictionRule, Definition.CombineRule, Definition.SimulationRule, Definition.InterpolationRule); \
+		break; \
+	}
+
+#define MARK_SCHEMA_ORDERED(TypeName) \
+	case EGMCE_SharedVariableType::TypeName: \
+		SharedVariables_##TypeName.bDeclarationOrdered = SharedVariables_##TypeName.Num() > 0; \
+		break;
+
+#define REPORT_SHARED_VARIABLES(TypeName) \
+	for (int32 Slot = 0; Slot < SharedVariables_##TypeName.Num(); Slot++) \
+	{ \
+		const auto& Variable = SharedVariables_##TypeName.Variables[Slot]; \
+		FGMCE_SharedVariableReportEntry& Entry = Report.AddDefaulted_GetRef(); \
+		Entry.VariableName = Variable.VariableName; \
+		Entry.Type = EGMCE_SharedVariableType::TypeName; \
+		Entry.BindIndex = Variable.BindIndex; \
+		Entry.bBound = Variable.BindIndex >= 0; \
+		Entry.PredictionRule = Variable.PredictionRule; \
+		Entry.SimulationRule = Variable.SimulationRule; \
+		Entry.EstimatedBits = EstimateSharedVariableBits(EGMCE_SharedVariableType::TypeName, Variable.CurrentValue); \
 	}
 
+namespace
+{
+	/// Rough serialized sizes per value; compressed types assume 16-bit quantization per component.
+	int32 EstimateSharedVariableBits(EGMCE_SharedVariableType Type)
+	{
+		switch (Type)
+		{
+		case EGMCE_SharedVariableType::Bool: return 1;
+		case EGMCE_SharedVariableType::HalfByte: return 4;
+		case EGMCE_SharedVariableType::Byte: return 8;
+		case EGMCE_SharedVariableType::Int: return 32;
+		case EGMCE_SharedVariableType::SinglePrecisionFloat: return 32;
+		case EGMCE_SharedVariableType::CompressedSinglePrecisionFloat: return 16;
+		case EGMCE_SharedVariableType::DoublePrecisionFloat: return 64;
+		case EGMCE_SharedVariableType::CompressedDoublePrecisionFloat: return 16;
+		case EGMCE_SharedVariableType::TruncatedDoublePrecisionFloat: return 32;
+		case EGMCE_SharedVariableType::CompressedVector2D: return 2 * 16;
+		case EGMCE_SharedVariableType::CompressedVector: return 3 * 16;
+		case EGMCE_SharedVariableType::CompressedRotator: return 3 * 16;
+		case EGMCE_SharedVariableType::ActorReference:
+		case EGMCE_SharedVariableType::ActorComponentReference:
+		case EGMCE_SharedVariableType::AnimMontageReference: return 32;
+		case EGMCE_SharedVariableType::Name: return 32;
+		case EGMCE_SharedVariableType::GameplayTag: return 16;
+		default: return 0;
+		}
+	}
+
+	template<typename T>
+	int32 EstimateSharedVariableBits(EGMCE_SharedVariableType Type, const T&)
+	{
+		return EstimateSharedVariableBits(Type);
+	}
+
+	int32 EstimateSharedVariableBits(EGMCE_SharedVariableType, const FGameplayTagContainer& Value)
+	{
+		return 8 + Value.Num() * 16;
+	}
+
+	int32 EstimateSharedVariableBits(EGMCE_SharedVariableType, const FInstancedStruct& Value)
+	{
+		// Struct type reference plus the raw struct size; an upper bound for most structs.
+		const UScriptStruct* ScriptStruct = Value.GetScriptStruct();
+		return 32 + (ScriptStruct ? ScriptStruct->GetStructureSize() * 8 : 0);
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs GMCESharedVariableReportCommand(
+	TEXT("gmce.SharedVariables.Report"),
+	TEXT("Log every shared variable on each GMCExtended core component in the world, with bind indices and estimated sizes. Optionally takes an owner name filter."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		for (TObjectIterator<UGMCE_CoreComponent> It; It; ++It)
+		{
+			if (It->GetWorld() != World || It->IsTemplate()) continue;
+			if (Args.Num() > 0 && !GetNameSafe(It->GetOwner()).Contains(Args[0])) continue;
+
+			It->LogSharedVariableReport();
+		}
+	}));
+
+#define CAPTURE_SHARED_VARIABLES(TypeName) \
+	OutSnapshot.Counts[static_cast<int32>(EGMCE_SharedVariableType::TypeName)] = SharedVariables_##TypeName.Num(); \
+	CaptureSharedVariableStore(SharedVariables_##TypeName, OutSnapshot);
+
 // Sets default values for this component's properties
 UGMCE_CoreComponent::UGMCE_CoreComponent()
 {
@@ -64,6 +191,9 @@ void UGMCE_CoreComponent::BindReplicationData_Implementation()
 		return;
 	}
 
+	// Schema-declared variables go in first, so that they keep their declared order.
+	ApplySharedVariableSchema();
+
 	// Make sure all our components get to register whatever variables they want.
 	for (UActorComponent* Component : Owner->GetComponents())
 	{
@@ -78,6 +208,9 @@ void UGMCE_CoreComponent::BindReplicationData_Implementation()
 		IGMCE_SharedVariableComponent::Execute_OnBindSharedVariables(GetGMCPawnOwner(), this);
 	}
 
+	// Typed variables were only registered above; bind them now, in an order that doesn't depend on components.
+	BindPendingTypedSharedVariables();
+
 	// Sort and bind each variable type.
 	BindSharedBoolVariables();
 	BindSharedHalfByteVariables();
@@ -97,6 +230,9 @@ void UGMCE_CoreComponent::BindReplicationData_Implementation()
 	BindSharedNameVariables();
 	BindSharedGameplayTagVariables();
 	BindSharedGameplayTagContainerVariables();
+	BindSharedInstancedStructVariables();
+
+	bSharedVariablesBound = true;
 }
 
 void UGMCE_CoreComponent::OnSyncDataApplied_Implementation(const FGMC_PawnState& State, EGMC_NetContext Context)
@@ -106,19 +242,471 @@ void UGMCE_CoreComponent::OnSyncDataApplied_Implementation(const FGMC_PawnState&
 	// These states should cover all post-movement, just-updated-from-server, and simulation update scenarios.
 	// This should ensure full coverage to check for variable updates (and notify any delegates) if values have
 	// changed since the last time through.
+	//
+	// Only variables GMC may have written itself are compared against their last value; everything else is only
+	// written through SetValue, which marks it dirty. A locally controlled pawn's own moves write nothing, while
+	// a remote client's moves carry the values it supplies, which the server adopts.
+	bool bCheck = false;
+	EGMCE_SharedVariableGather Gather = EGMCE_SharedVariableGather::DirtyOnly;
 	if (Context == EGMC_NetContext::LocalClientPawn_PostMoveExecution ||
 		Context == EGMC_NetContext::LocalClientPawn_ServerStateAdopted ||
 		Context == EGMC_NetContext::LocalServerPawn_PostMoveExecution ||
-		Context == EGMC_NetContext::RemoteServerPawn_PostMoveExecution ||
-		Context == EGMC_NetContext::RemoteClientPawn_Simulation)
+		Context == EGMC_NetContext::RemoteServerPawn_PostMoveExecution)
+	{
+		if (Context == EGMC_NetContext::LocalClientPawn_ServerStateAdopted || CL_IsReplaying())
+		{
+			Gather = EGMCE_SharedVariableGather::All;
+		}
+		else if (Context == EGMC_NetContext::RemoteServerPawn_PostMoveExecution)
+		{
+			Gather = EGMCE_SharedVariableGather::ClientSupplied;
+		}
+
+		// Replayed moves will be followed by a fresh move, which reports the net change in one go.
+		bCheck = (bNotifySharedVariablesDuringReplay || !CL_IsReplaying()) && HasSharedVariableListeners();
+	}
+	else if (Context == EGMC_NetContext::RemoteClientPawn_Simulation)
+	{
+		Gather = EGMCE_SharedVariableGather::Simulated;
+		bCheck = bNotifySharedVariablesOnSimulatedProxies && HasSharedVariableListeners();
+	}
+	else
+	{
+		return;
+	}
+
+	if (!bCheck)
+	{
+		bSharedVariableFullGatherOwed |= Gather != EGMCE_SharedVariableGather::DirtyOnly;
+		return;
+	}
+
+	TGuardValue<EGMCE_SharedVariableGather> GatherGuard(SharedVariableGather, bSharedVariableFullGatherOwed ? EGMCE_SharedVariableGather::All : Gather);
+	bSharedVariableFullGatherOwed = false;
+	CheckForSharedVariableUpdates();
+}
+
+void UGMCE_CoreComponent::ApplySharedVariableSchema()
+{
+	if (!SharedVariableSchema) return;
+
+	// Size every store up front, so that building them is a single pass with no reallocation.
+	constexpr int32 TypeCount = static_cast<int32>(EGMCE_SharedVariableType::Invalid);
+	int32 Counts[TypeCount] = { 0 };
+	for (const FGMCE_SharedVariableDefinition& Definition : SharedVariableSchema->Variables)
 	{
-		CheckForSharedVariableUpdates();
+		if (Definition.Type < EGMCE_SharedVariableType::Invalid) Counts[static_cast<int32>(Definition.Type)]++;
+	}
+
+	TBitArray<> WasEmpty(false, TypeCount);
+	RESERVE_SCHEMA_VARIABLES(Bool)
+	RESERVE_SCHEMA_VARIABLES(HalfByte)
+	RESERVE_SCHEMA_VARIABLES(Byte)
+	RESERVE_SCHEMA_VARIABLES(Int)
+	RESERVE_SCHEMA_VARIABLES(SinglePrecisionFloat)
+	RESERVE_SCHEMA_VARIABLES(CompressedSinglePrecisionFloat)
+	RESERVE_SCHEMA_VARIABLES(DoublePrecisionFloat)
+	RESERVE_SCHEMA_VARIABLES(CompressedDoublePrecisionFloat)
+	RESERVE_SCHEMA_VARIABLES(TruncatedDoublePrecisionFloat)
+	RESERVE_SCHEMA_VARIABLES(CompressedVector2D)
+	RESERVE_SCHEMA_VARIABLES(CompressedVector)
+	RESERVE_SCHEMA_VARIABLES(CompressedRotator)
+	RESERVE_SCHEMA_VARIABLES(ActorReference)
+	RESERVE_SCHEMA_VARIABLES(ActorComponentReference)
+	RESERVE_SCHEMA_VARIABLES(AnimMontageReference)
+	RESERVE_SCHEMA_VARIABLES(Name)
+	RESERVE_SCHEMA_VARIABLES(GameplayTag)
+	RESERVE_SCHEMA_VARIABLES(GameplayTagContainer)
+	RESERVE_SCHEMA_VARIABLES(InstancedStruct)
+
+	// Defaults are parsed once per asset; only a schema built or changed at runtime needs parsing here.
+	if (!SharedVariableSchema->HasParsedDefaultValues()) SharedVariableSchema->ParseDefaultValues();
+
+	for (int32 Index = 0; Index < SharedVariableSchema->Variables.Num(); Index++)
+	{
+		const FGMCE_SharedVariableDefinition& Definition = SharedVariableSchema->Variables[Index];
+		switch (Definition.Type)
+		{
+		APPLY_SCHEMA_DEFINITION(Bool)
+		APPLY_SCHEMA_DEFINITION(HalfByte)
+		APPLY_SCHEMA_DEFINITION(Byte)
+		APPLY_SCHEMA_DEFINITION(Int)
+		APPLY_SCHEMA_DEFINITION(SinglePrecisionFloat)
+		APPLY_SCHEMA_DEFINITION(CompressedSinglePrecisionFloat)
+		APPLY_SCHEMA_DEFINITION(DoublePrecisionFloat)
+		APPLY_SCHEMA_DEFINITION(CompressedDoublePrecisionFloat)
+		APPLY_SCHEMA_DEFINITION(TruncatedDoublePrecisionFloat)
+		APPLY_SCHEMA_DEFINITION(CompressedVector2D)
+		APPLY_SCHEMA_DEFINITION(CompressedVector)
+		APPLY_SCHEMA_DEFINITION(CompressedRotator)
+		APPLY_SCHEMA_DEFINITION(ActorReference)
+		APPLY_SCHEMA_DEFINITION(ActorComponentReference)
+		APPLY_SCHEMA_DEFINITION(AnimMontageReference)
+		APPLY_SCHEMA_DEFINITION(Name)
+		APPLY_SCHEMA_DEFINITION(GameplayTag)
+		APPLY_SCHEMA_DEFINITION(GameplayTagContainer)
+		APPLY_SCHEMA_DEFINITION(InstancedStruct)
+		default:
+			UE_LOG(LogGMCExtended, Warning, TEXT("%s: shared variable schema %s declares %s with an invalid type."),
+				*GetName(), *SharedVariableSchema->GetName(), *Definition.VariableName.ToString());
+			break;
+		}
+	}
+
+	// A store which held nothing but schema variables can bind in schema order, which is identical on both sides
+	// of the connection; anything made at runtime resets this and falls back to sorting by name.
+	for (TConstSetBitIterator<> It(WasEmpty); It; ++It)
+	{
+		switch (static_cast<EGMCE_SharedVariableType>(It.GetIndex()))
+		{
+		MARK_SCHEMA_ORDERED(Bool)
+		MARK_SCHEMA_ORDERED(HalfByte)
+		MARK_SCHEMA_ORDERED(Byte)
+		MARK_SCHEMA_ORDERED(Int)
+		MARK_SCHEMA_ORDERED(SinglePrecisionFloat)
+		MARK_SCHEMA_ORDERED(CompressedSinglePrecisionFloat)
+		MARK_SCHEMA_ORDERED(DoublePrecisionFloat)
+		MARK_SCHEMA_ORDERED(CompressedDoublePrecisionFloat)
+		MARK_SCHEMA_ORDERED(TruncatedDoublePrecisionFloat)
+		MARK_SCHEMA_ORDERED(CompressedVector2D)
+		MARK_SCHEMA_ORDERED(CompressedVector)
+		MARK_SCHEMA_ORDERED(CompressedRotator)
+		MARK_SCHEMA_ORDERED(ActorReference)
+		MARK_SCHEMA_ORDERED(ActorComponentReference)
+		MARK_SCHEMA_ORDERED(AnimMontageReference)
+		MARK_SCHEMA_ORDERED(Name)
+		MARK_SCHEMA_ORDERED(GameplayTag)
+		MARK_SCHEMA_ORDERED(GameplayTagContainer)
+		MARK_SCHEMA_ORDERED(InstancedStruct)
+		default:
+			break;
+		}
 	}
 }
 
+void UGMCE_CoreComponent::LogFailedSharedVariableBind(EGMCE_SharedVariableType Type, const FName& VariableName) const
+{
+	// Usually means GMC's limit on bindings of this type has been reached.
+	UE_LOG(LogGMCExtended, Warning, TEXT("%s: %s shared variable %s failed to bind and will not be replicated."),
+		*GetName(), *StaticEnum<EGMCE_SharedVariableType>()->GetNameStringByValue(static_cast<int64>(Type)), *VariableName.ToString());
+}
+
+TArray<FGMCE_SharedVariableReportEntry> UGMCE_CoreComponent::GetSharedVariableReport() const
+{
+	TArray<FGMCE_SharedVariableReportEntry> Report;
+
+	REPORT_SHARED_VARIABLES(Bool)
+	REPORT_SHARED_VARIABLES(HalfByte)
+	REPORT_SHARED_VARIABLES(Byte)
+	REPORT_SHARED_VARIABLES(Int)
+	REPORT_SHARED_VARIABLES(SinglePrecisionFloat)
+	REPORT_SHARED_VARIABLES(CompressedSinglePrecisionFloat)
+	REPORT_SHARED_VARIABLES(DoublePrecisionFloat)
+	REPORT_SHARED_VARIABLES(CompressedDoublePrecisionFloat)
+	REPORT_SHARED_VARIABLES(TruncatedDoublePrecisionFloat)
+	REPORT_SHARED_VARIABLES(CompressedVector2D)
+	REPORT_SHARED_VARIABLES(CompressedVector)
+	REPORT_SHARED_VARIABLES(CompressedRotator)
+	REPORT_SHARED_VARIABLES(ActorReference)
+	REPORT_SHARED_VARIABLES(ActorComponentReference)
+	REPORT_SHARED_VARIABLES(AnimMontageReference)
+	REPORT_SHARED_VARIABLES(Name)
+	REPORT_SHARED_VARIABLES(GameplayTag)
+	REPORT_SHARED_VARIABLES(GameplayTagContainer)
+	REPORT_SHARED_VARIABLES(InstancedStruct)
+
+	// Bools are reported first, so their entries line up with their slots.
+	for (int32 Slot = 0; Slot < PackedBoolLocations.Num(); Slot++)
+	{
+		Report[Slot].bPacked = PackedBoolLocations[Slot] != INDEX_NONE;
+	}
+
+	Report.Append(TypedSharedVariableReport);
+
+	return Report;
+}
+
+void UGMCE_CoreComponent::LogSharedVariableReport() const
+{
+	const UEnum* TypeEnum = StaticEnum<EGMCE_SharedVariableType>();
+	const TArray<FGMCE_SharedVariableReportEntry> Report = GetSharedVariableReport();
+
+	UE_LOG(LogGMCExtended, Display, TEXT("%s (%s): %d shared variables"), *GetName(), *GetNameSafe(GetOwner()), Report.Num());
+
+	constexpr int32 TypeCount = static_cast<int32>(EGMCE_SharedVariableType::Invalid);
+	int32 Bound[TypeCount] = { 0 };
+	int32 Failed[TypeCount] = { 0 };
+	int32 Bits[TypeCount] = { 0 };
+	int32 SimulatedBits[TypeCount] = { 0 };
+
+	for (const FGMCE_SharedVariableReportEntry& Entry : Report)
+	{
+		const int32 TypeIndex = static_cast<int32>(Entry.Type);
+		UE_LOG(LogGMCExtended, Display, TEXT("  %-32s %-32s bind %3d%s %-28s ~%d bits"),
+			*Entry.VariableName.ToString(),
+			*TypeEnum->GetNameStringByValue(TypeIndex),
+			Entry.BindIndex,
+			Entry.bPacked ? TEXT(" (packed)") : (!Entry.bBound && bSharedVariablesBound ? TEXT(" (FAILED)") : (Entry.bTyped ? TEXT(" (typed) ") : TEXT("         "))),
+			*UEnum::GetValueAsString(Entry.SimulationRule),
+			Entry.EstimatedBits);
+
+		if (!Entry.bBound)
+		{
+			if (bSharedVariablesBound) Failed[TypeIndex]++;
+			continue;
+		}
+
+		Bound[TypeIndex]++;
+		if (!Entry.bPacked)
+		{
+			Bits[TypeIndex] += Entry.EstimatedBits;
+			if (Entry.SimulationRule != EGMC_SimulationMode::None) SimulatedBits[TypeIndex] += Entry.EstimatedBits;
+		}
+	}
+
+	// Packed Bools are serialized as whole words, whichever bits are in use.
+	int32 PackedWords = 0;
+	int32 PackedVariables = 0;
+	for (int32 Word = 0; Word < PackedSharedBools.Num(); Word++)
+	{
+		if (PackedSharedBools[Word].BindIndex < 0) continue;
+
+		const int32 TypeIndex = static_cast<int32>(EGMCE_SharedVariableType::Bool);
+		Bits[TypeIndex] += 32;
+		const int32 FirstSlot = PackedBoolSlots[Word * 32];
+		if (SharedVariables_Bool.Variables[FirstSlot].SimulationRule != EGMC_SimulationMode::None) SimulatedBits[TypeIndex] += 32;
+
+		PackedWords++;
+		for (int32 Bit = 0; Bit < 32; Bit++)
+		{
+			if (PackedBoolSlots[Word * 32 + Bit] != INDEX_NONE) PackedVariables++;
+		}
+	}
+
+	int32 TotalBits = 0;
+	int32 TotalSimulatedBits = 0;
+	for (int32 TypeIndex = 0; TypeIndex < TypeCount; TypeIndex++)
+	{
+		if (Bound[TypeIndex] == 0 && Failed[TypeIndex] == 0) continue;
+
+		UE_LOG(LogGMCExtended, Display, TEXT("  %-32s %3d bound, %3d failed, ~%d bits (~%d to simulated proxies)"),
+			*TypeEnum->GetNameStringByValue(TypeIndex), Bound[TypeIndex], Failed[TypeIndex], Bits[TypeIndex], SimulatedBits[TypeIndex]);
+		TotalBits += Bits[TypeIndex];
+		TotalSimulatedBits += SimulatedBits[TypeIndex];
+	}
+
+	if (PackedWords > 0)
+	{
+		// Unpacked, each of those Bools would cost a single bit and a Bool binding instead.
+		UE_LOG(LogGMCExtended, Display, TEXT("  Packed Bools: %d in %d words, %d bits and %d Int bindings (%d bits and %d Bool bindings unpacked)"),
+			PackedVariables, PackedWords, PackedWords * 32, PackedWords, PackedVariables, PackedVariables);
+	}
+
+	UE_LOG(LogGMCExtended, Display, TEXT("  Total: ~%d bits per full serialization (~%d to simulated proxies)"), TotalBits, TotalSimulatedBits);
+}
+
+namespace
+{
+	template<typename ElementType>
+	void ResizeWithoutShrinking(TArray<ElementType>& Array, int32 Num)
+	{
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+		Array.SetNum(Num, false);
+#else
+		Array.SetNum(Num, EAllowShrinking::No);
+#endif
+	}
+}
+
+template<typename T>
+void UGMCE_CoreComponent::CaptureSharedVariableStore(const TGMCE_SharedVariableStore<T>& Store, FGMCE_SharedVariableSnapshot& Snapshot)
+{
+	static_assert(std::is_trivially_copyable_v<T>, "Shared variable types which own memory need their own capture overload.");
+
+	const int32 Offset = Snapshot.Data.AddUninitialized(Store.Num() * sizeof(T));
+	for (int32 Slot = 0; Slot < Store.Num(); Slot++)
+	{
+		FMemory::Memcpy(&Snapshot.Data[Offset + Slot * sizeof(T)], &Store.Variables[Slot].CurrentValue, sizeof(T));
+	}
+}
+
+void UGMCE_CoreComponent::CaptureSharedVariableStore(const TGMCE_SharedVariableStore<FGameplayTagContainer>& Store, FGMCE_SharedVariableSnapshot& Snapshot)
+{
+	// Assign into the existing elements rather than adding new ones, so each container's tag arrays are reused.
+	ResizeWithoutShrinking(Snapshot.GameplayTagContainers, Store.Num());
+	for (int32 Slot = 0; Slot < Store.Num(); Slot++)
+	{
+		Snapshot.GameplayTagContainers[Slot] = Store.Variables[Slot].CurrentValue;
+	}
+}
+
+void UGMCE_CoreComponent::CaptureSharedVariableStore(const TGMCE_SharedVariableStore<FInstancedStruct>& Store, FGMCE_SharedVariableSnapshot& Snapshot)
+{
+	// As above; assigning a struct of the same type reuses its memory.
+	ResizeWithoutShrinking(Snapshot.InstancedStructs, Store.Num());
+	for (int32 Slot = 0; Slot < Store.Num(); Slot++)
+	{
+		Snapshot.InstancedStructs[Slot] = Store.Variables[Slot].CurrentValue;
+	}
+}
+
+template<typename T>
+void UGMCE_CoreComponent::RestoreSharedVariableStore(TGMCE_SharedVariableStore<T>& Store, const FGMCE_SharedVariableSnapshot& Snapshot, int32& Offset)
+{
+	for (int32 Slot = 0; Slot < Store.Num(); Slot++, Offset += sizeof(T))
+	{
+		if (!Store.IsValidSlot(Slot)) continue;
+
+		T Value;
+		FMemory::Memcpy(&Value, &Snapshot.Data[Offset], sizeof(T));
+		Store.SetValue(Slot, Value);
+	}
+}
+
+void UGMCE_CoreComponent::RestoreSharedVariableStore(TGMCE_SharedVariableStore<FGameplayTagContainer>& Store, const FGMCE_SharedVariableSnapshot& Snapshot)
+{
+	for (int32 Slot = 0; Slot < Store.Num(); Slot++)
+	{
+		if (Store.IsValidSlot(Slot)) Store.SetValue(Slot, Snapshot.GameplayTagContainers[Slot]);
+	}
+}
+
+void UGMCE_CoreComponent::RestoreSharedVariableStore(TGMCE_SharedVariableStore<FInstancedStruct>& Store, const FGMCE_SharedVariableSnapshot& Snapshot)
+{
+	for (int32 Slot = 0; Slot < Store.Num(); Slot++)
+	{
+		if (Store.IsValidSlot(Slot)) Store.SetValue(Slot, Snapshot.InstancedStructs[Slot]);
+	}
+}
+
+void UGMCE_CoreComponent::CaptureSharedVariables(FGMCE_SharedVariableSnapshot& OutSnapshot) const
+{
+	OutSnapshot.Reset();
+
+	CAPTURE_SHARED_VARIABLES(Bool)
+	CAPTURE_SHARED_VARIABLES(HalfByte)
+	CAPTURE_SHARED_VARIABLES(Byte)
+	CAPTURE_SHARED_VARIABLES(Int)
+	CAPTURE_SHARED_VARIABLES(SinglePrecisionFloat)
+	CAPTURE_SHARED_VARIABLES(CompressedSinglePrecisionFloat)
+	CAPTURE_SHARED_VARIABLES(DoublePrecisionFloat)
+	CAPTURE_SHARED_VARIABLES(CompressedDoublePrecisionFloat)
+	CAPTURE_SHARED_VARIABLES(TruncatedDoublePrecisionFloat)
+	CAPTURE_SHARED_VARIABLES(CompressedVector2D)
+	CAPTURE_SHARED_VARIABLES(CompressedVector)
+	CAPTURE_SHARED_VARIABLES(CompressedRotator)
+	CAPTURE_SHARED_VARIABLES(ActorReference)
+	CAPTURE_SHARED_VARIABLES(ActorComponentReference)
+	CAPTURE_SHARED_VARIABLES(AnimMontageReference)
+	CAPTURE_SHARED_VARIABLES(Name)
+	CAPTURE_SHARED_VARIABLES(GameplayTag)
+	CAPTURE_SHARED_VARIABLES(GameplayTagContainer)
+	CAPTURE_SHARED_VARIABLES(InstancedStruct)
+
+	// Bools are captured first, one byte per slot; packed words may be newer than the variables themselves.
+	for (int32 Slot = 0; Slot < PackedBoolLocations.Num(); Slot++)
+	{
+		if (PackedBoolLocations[Slot] != INDEX_NONE)
+		{
+			OutSnapshot.Data[Slot * sizeof(bool)] = ReadSharedBool(Slot);
+		}
+	}
+}
+
+bool UGMCE_CoreComponent::RestoreSharedVariables(const FGMCE_SharedVariableSnapshot& Snapshot)
+{
+	const bool bLayoutMatches =
+		SharedVariables_Bool.Num() == Snapshot.Counts[static_cast<int32>(EGMCE_SharedVariableType::Bool)] &&
+		SharedVariables_HalfByte.Num() == Snapshot.Counts[static_cast<int32>(EGMCE_SharedVariableType::HalfByte)] &&
+		SharedVariables_Byte.Num() == Snapshot.Counts[static_cast<int32>(EGMCE_SharedVariableType::Byte)] &&
+		SharedVariables_Int.Num() == Snapshot.Counts[static_cast<int32>(EGMCE_SharedVariableType::Int)] &&
+		SharedVariables_SinglePrecisionFloat.Num() == Snapshot.Counts[static_cast<int32>(EGMCE_SharedVariableType::SinglePrecisionFloat)] &&
+		SharedVariables_CompressedSinglePrecisionFloat.Num() == Snapshot.Counts[static_cast<int32>(EGMCE_SharedVariableType::CompressedSinglePrecisionFloat)] &&
+		SharedVariables_DoublePrecisionFloat.Num() == Snapshot.Counts[static_cast<int32>(EGMCE_SharedVariableType::DoublePrecisionFloat)] &&
+		SharedVariables_CompressedDoublePrecisionFloat.Num() == Snapshot.Counts[static_cast<int32>(EGMCE_SharedVariableType::CompressedDoublePrecisionFloat)] &&
+		SharedVariables_TruncatedDoublePrecisionFloat.Num() == Snapshot.Counts[static_cast<int32>(EGMCE_SharedVariableType::TruncatedDoublePrecisionFloat)] &&
+		SharedVariables_CompressedVector2D.Num() == Snapshot.Counts[static_cast<int32>(EGMCE_SharedVariableType::CompressedVector2D)] &&
+		SharedVariables_CompressedVector.Num() == Snapshot.Counts[static_cast<int32>(EGMCE_SharedVariableType::CompressedVector)] &&
+		SharedVariables_CompressedRotator.Num() == Snapshot.Counts[static_cast<int32>(EGMCE_SharedVariableType::CompressedRotator)] &&
+		SharedVariables_ActorReference.Num() == Snapshot.Counts[static_cast<int32>(EGMCE_SharedVariableType::ActorReference)] &&
+		SharedVariables_ActorComponentReference.Num() == Snapshot.Counts[static_cast<int32>(EGMCE_SharedVariableType::ActorComponentReference)] &&
+		SharedVariables_AnimMontageReference.Num() == Snapshot.Counts[static_cast<int32>(EGMCE_SharedVariableType::AnimMontageReference)] &&
+		SharedVariables_Name.Num() == Snapshot.Counts[static_cast<int32>(EGMCE_SharedVariableType::Name)] &&
+		SharedVariables_GameplayTag.Num() == Snapshot.Counts[static_cast<int32>(EGMCE_SharedVariableType::GameplayTag)] &&
+		SharedVariables_GameplayTagContainer.Num() == Snapshot.Counts[static_cast<int32>(EGMCE_SharedVariableType::GameplayTagContainer)] &&
+		SharedVariables_InstancedStruct.Num() == Snapshot.Counts[static_cast<int32>(EGMCE_SharedVariableType::InstancedStruct)];
+	if (!bLayoutMatches)
+	{
+		UE_LOG(LogGMCExtended, Warning, TEXT("%s: cannot restore a shared variable snapshot taken from a different set of shared variables."), *GetName());
+		return false;
+	}
+
+	int32 Offset = 0;
+	RestoreSharedVariableStore(SharedVariables_Bool, Snapshot, Offset);
+	RestoreSharedVariableStore(SharedVariables_HalfByte, Snapshot, Offset);
+	RestoreSharedVariableStore(SharedVariables_Byte, Snapshot, Offset);
+	RestoreSharedVariableStore(SharedVariables_Int, Snapshot, Offset);
+	RestoreSharedVariableStore(SharedVariables_SinglePrecisionFloat, Snapshot, Offset);
+	RestoreSharedVariableStore(SharedVariables_CompressedSinglePrecisionFloat, Snapshot, Offset);
+	RestoreSharedVariableStore(SharedVariables_DoublePrecisionFloat, Snapshot, Offset);
+	RestoreSharedVariableStore(SharedVariables_CompressedDoublePrecisionFloat, Snapshot, Offset);
+	RestoreSharedVariableStore(SharedVariables_TruncatedDoublePrecisionFloat, Snapshot, Offset);
+	RestoreSharedVariableStore(SharedVariables_CompressedVector2D, Snapshot, Offset);
+	RestoreSharedVariableStore(SharedVariables_CompressedVector, Snapshot, Offset);
+	RestoreSharedVariableStore(SharedVariables_CompressedRotator, Snapshot, Offset);
+	RestoreSharedVariableStore(SharedVariables_ActorReference, Snapshot, Offset);
+	RestoreSharedVariableStore(SharedVariables_ActorComponentReference, Snapshot, Offset);
+	RestoreSharedVariableStore(SharedVariables_AnimMontageReference, Snapshot, Offset);
+	RestoreSharedVariableStore(SharedVariables_Name, Snapshot, Offset);
+	RestoreSharedVariableStore(SharedVariables_GameplayTag, Snapshot, Offset);
+	RestoreSharedVariableStore(SharedVariables_GameplayTagContainer, Snapshot);
+	RestoreSharedVariableStore(SharedVariables_InstancedStruct, Snapshot);
+
+	// Keep packed words in step with the restored values.
+	for (int32 Slot = 0; Slot < PackedBoolLocations.Num(); Slot++)
+	{
+		if (PackedBoolLocations[Slot] != INDEX_NONE && SharedVariables_Bool.IsValidSlot(Slot))
+		{
+			WriteSharedBool(Slot, SharedVariables_Bool.Variables[Slot].CurrentValue);
+		}
+	}
+
+	return true;
+}
+
+bool UGMCE_CoreComponent::HasSharedVariableListeners() const
+{
+	return OnSharedVariablesChanged.IsBound() ||
+		OnSharedBoolChange.IsBound() ||
+		OnSharedHalfByteChange.IsBound() ||
+		OnSharedByteChange.IsBound() ||
+		OnSharedIntChange.IsBound() ||
+		OnSharedSinglePrecisionFloatChange.IsBound() ||
+		OnSharedCompressedSinglePrecisionFloatChange.IsBound() ||
+		OnSharedDoublePrecisionFloatChange.IsBound() ||
+		OnSharedCompressedDoublePrecisionFloatChange.IsBound() ||
+		OnSharedTruncatedDoublePrecisionFloatChange.IsBound() ||
+		OnSharedCompressedVector2DChange.IsBound() ||
+		OnSharedCompressedVectorChange.IsBound() ||
+		OnSharedCompressedRotatorChange.IsBound() ||
+		OnSharedActorReferenceChange.IsBound() ||
+		OnSharedActorComponentReferenceChange.IsBound() ||
+		OnSharedAnimMontageReferenceChange.IsBound() ||
+		OnSharedNameChange.IsBound() ||
+		OnSharedGameplayTagChange.IsBound() ||
+		OnSharedGameplayTagContainerChange.IsBound() ||
+		OnSharedInstancedStructChange.IsBound();
+}
+
 void UGMCE_CoreComponent::CheckForSharedVariableUpdates()
 {
-	// Handle notification for any shared variable bindings where the values have changed.
+	// Handle notification for any shared variable bindings where the values have changed. Only slots flagged
+	// as dirty are notified; types with no registered variables or no listeners are skipped outright, and
+	// will report their accumulated change once something starts listening.
+	const bool bCollectChanges = OnSharedVariablesChanged.IsBound();
+	PendingSharedVariableChanges.Reset();
+
+	UnpackSharedBools();
 	POST_MOVEMENT_HANDLER(Bool, bool)
 	POST_MOVEMENT_HANDLER(HalfByte, uint8)
 	POST_MOVEMENT_HANDLER(Byte, uint8)
@@ -136,45 +724,212 @@ void UGMCE_CoreComponent::CheckForSharedVariableUpdates()
 	POST_MOVEMENT_HANDLER(AnimMontageReference, UAnimMontage*)
 	POST_MOVEMENT_HANDLER(Name, FName)
 	POST_MOVEMENT_HANDLER(GameplayTag, FGameplayTag)
-	POST_MOVEMENT_HANDLER(GameplayTagContainer, FGameplayTagContainer)	POST_MOVEMENT_HANDLER(Bool, bool)
-	POST_MOVEMENT_HANDLER(HalfByte, uint8)
-	POST_MOVEMENT_HANDLER(Byte, uint8)
-	POST_MOVEMENT_HANDLER(Int, int32)
-	POST_MOVEMENT_HANDLER(SinglePrecisionFloat, float)
-	POST_MOVEMENT_HANDLER(CompressedSinglePrecisionFloat, float)
-	POST_MOVEMENT_HANDLER(DoublePrecisionFloat, double)
-	POST_MOVEMENT_HANDLER(CompressedDoublePrecisionFloat, double)
-	POST_MOVEMENT_HANDLER(TruncatedDoublePrecisionFloat, double)
-	POST_MOVEMENT_HANDLER(CompressedVector2D, FVector2D)
-	POST_MOVEMENT_HANDLER(CompressedVector, FVector)
-	POST_MOVEMENT_HANDLER(CompressedRotator, FRotator)
-	POST_MOVEMENT_HANDLER(ActorReference, AActor*)
-	POST_MOVEMENT_HANDLER(ActorComponentReference, UActorComponent*)
-	POST_MOVEMENT_HANDLER(AnimMontageReference, UAnimMontage*)
-	POST_MOVEMENT_HANDLER(Name, FName)
-	POST_MOVEMENT_HANDLER(GameplayTag, FGameplayTag)
-	POST_MOVEMENT_HANDLER(GameplayTagContainer, FGameplayTagContainer)			
+	POST_MOVEMENT_HANDLER(GameplayTagContainer, FGameplayTagContainer)
+	NotifySharedInstancedStructChanges(bCollectChanges);
+
+	if (bCollectChanges && PendingSharedVariableChanges.Num() > 0)
+	{
+		OnSharedVariablesChanged.Broadcast(PendingSharedVariableChanges);
+	}
+}
+
+void UGMCE_CoreComponent::NotifySharedInstancedStructChanges(bool bCollectChanges)
+{
+	auto& Store = SharedVariables_InstancedStruct;
+	const bool bBroadcastDynamic = OnSharedInstancedStructChange.IsBound();
+	if (!(bCollectChanges || bBroadcastDynamic) || !Store.GatherChanges(SharedVariableGather)) return;
+
+	TArray<FName, TInlineAllocator<16>> ChangedFields;
+	for (int32 Slot = Store.DirtySlots.Find(true); Slot != INDEX_NONE; Slot = Store.DirtySlots.FindFrom(true, Slot + 1))
+	{
+		Store.DirtySlots[Slot] = false;
+		auto& Variable = Store.Variables[Slot];
+		if (!Variable.WasUpdated()) continue;
+
+		// Diff top-level fields when the struct type is unchanged; otherwise the whole value is reported as changed.
+		ChangedFields.Reset();
+		const UScriptStruct* ScriptStruct = Variable.CurrentValue.GetScriptStruct();
+		if (ScriptStruct && ScriptStruct == Variable.OldValue.GetScriptStruct())
+		{
+			for (TFieldIterator<FProperty> It(ScriptStruct); It; ++It)
+			{
+				if (!It->Identical_InContainer(Variable.OldValue.GetMemory(), Variable.CurrentValue.GetMemory()))
+				{
+					ChangedFields.Add(It->GetFName());
+				}
+			}
+		}
+		else
+		{
+			ChangedFields.Add(NAME_None);
+		}
+
+		const FInstancedStruct PreviousValue = MoveTemp(Variable.OldValue);
+		Variable.OldValue = Variable.CurrentValue;
+
+		for (const FName& FieldName : ChangedFields)
+		{
+			if (bCollectChanges)
+			{
+				FGMCE_SharedVariableChange& Change = PendingSharedVariableChanges.AddDefaulted_GetRef();
+				Change.Handle.Type = EGMCE_SharedVariableType::InstancedStruct;
+				Change.Handle.Slot = Slot;
+				Change.VariableName = Variable.VariableName;
+				Change.FieldName = FieldName;
+				Change.OldValue.Set<FInstancedStruct>(PreviousValue);
+				Change.NewValue.Set<FInstancedStruct>(Variable.CurrentValue);
+			}
+
+			if (bBroadcastDynamic)
+			{
+				OnSharedInstancedStructChange.Broadcast(Variable.VariableName, FieldName, Variable.CurrentValue, PreviousValue);
+			}
+		}
+	}
+}
+
+FGMCE_SharedVariableHandle UGMCE_CoreComponent::FindSharedVariableHandle(EGMCE_SharedVariableType Type, const FName& VariableName) const
+{
+	FGMCE_SharedVariableHandle Handle;
+
+	switch (Type)
+	{
+	FIND_SHARED_VARIABLE_HANDLE(Bool)
+	FIND_SHARED_VARIABLE_HANDLE(HalfByte)
+	FIND_SHARED_VARIABLE_HANDLE(Byte)
+	FIND_SHARED_VARIABLE_HANDLE(Int)
+	FIND_SHARED_VARIABLE_HANDLE(SinglePrecisionFloat)
+	FIND_SHARED_VARIABLE_HANDLE(CompressedSinglePrecisionFloat)
+	FIND_SHARED_VARIABLE_HANDLE(DoublePrecisionFloat)
+	FIND_SHARED_VARIABLE_HANDLE(CompressedDoublePrecisionFloat)
+	FIND_SHARED_VARIABLE_HANDLE(TruncatedDoublePrecisionFloat)
+	FIND_SHARED_VARIABLE_HANDLE(CompressedVector2D)
+	FIND_SHARED_VARIABLE_HANDLE(CompressedVector)
+	FIND_SHARED_VARIABLE_HANDLE(CompressedRotator)
+	FIND_SHARED_VARIABLE_HANDLE(ActorReference)
+	FIND_SHARED_VARIABLE_HANDLE(ActorComponentReference)
+	FIND_SHARED_VARIABLE_HANDLE(AnimMontageReference)
+	FIND_SHARED_VARIABLE_HANDLE(Name)
+	FIND_SHARED_VARIABLE_HANDLE(GameplayTag)
+	FIND_SHARED_VARIABLE_HANDLE(GameplayTagContainer)
+	FIND_SHARED_VARIABLE_HANDLE(InstancedStruct)
+	default:
+		break;
+	}
+
+	return Handle;
 }
 
+bool UGMCE_CoreComponent::CanMakeSharedVariable(const FName& VariableName) const
+{
+	if (bSharedVariablesBound)
+	{
+		// Variable storage is referenced directly by GMC once bound; growing it now would invalidate those bindings.
+		UE_LOG(LogGMCExtended, Warning, TEXT("%s: cannot make shared variable %s after replication data has been bound."), *GetName(), *VariableName.ToString());
+		return false;
+	}
+
+	return true;
+}
+
+template<typename T>
+void UGMCE_CoreComponent::WarnIfSharedVariableRedefined(EGMCE_SharedVariableType Type, const TGMCE_SharedVariable<T>& Existing,
+	const T& DefaultValue, EGMC_PredictionMode PredictionRule, EGMC_CombineMode CombineRule, EGMC_SimulationMode SimulationRule,
+	EGMC_InterpolationFunction InterpolationRule) const
+{
+	if (Existing.CurrentValue == DefaultValue && Existing.PredictionRule == PredictionRule && Existing.CombineRule == CombineRule &&
+		Existing.SimulationRule == SimulationRule && Existing.InterpolationRule == InterpolationRule) return;
+
+	UE_LOG(LogGMCExtended, Warning, TEXT("%s: %s shared variable %s already exists%s with a different default value or replication rules; keeping the existing definition."),
+		*GetName(), *StaticEnum<EGMCE_SharedVariableType>()->GetNameStringByValue(static_cast<int64>(Type)), *Existing.VariableName.ToString(),
+		SharedVariableSchema ? TEXT(" (possibly from the shared variable schema)") : TEXT(""));
+}
 
 // ---- shared variable implementations
+template<EGMCE_SharedVariableType Type, typename BindFunction>
+bool UGMCE_CoreComponent::BindTypedSharedVariable(TGMCE_TypedSharedVariable<Type>& Variable, BindFunction&& Bind)
+{
+	if (!CanMakeSharedVariable(Variable.VariableName)) return false;
+
+	for (const FGMCE_PendingTypedSharedVariable& Pending : PendingTypedSharedVariables)
+	{
+		if (Pending.Variable == &Variable) return true;
+
+		// Two variables with the same type and name would have no agreed order between server and client.
+		if (Pending.Type == Type && Pending.VariableName == Variable.VariableName)
+		{
+			UE_LOG(LogGMCExtended, Warning, TEXT("%s: typed shared variable %s is already registered with the same type."), *GetName(), *Variable.VariableName.ToString());
+			return false;
+		}
+	}
+
+	PendingTypedSharedVariables.Add({ Type, Variable.VariableName, &Variable, [this, &Variable, Bind]()
+	{
+		Variable.BindIndex = Bind(
+			Variable.CurrentValue,
+			Variable.PredictionRule,
+			Variable.CombineRule,
+			Variable.SimulationRule,
+			Variable.InterpolationRule
+		);
+		Variable.OldValue = Variable.CurrentValue;
+
+		if (Variable.BindIndex < 0)
+		{
+			UE_LOG(LogGMCExtended, Warning, TEXT("%s: typed shared variable %s failed to bind."), *GetName(), *Variable.VariableName.ToString());
+		}
+
+		FGMCE_SharedVariableReportEntry& Entry = TypedSharedVariableReport.AddDefaulted_GetRef();
+		Entry.VariableName = Variable.VariableName;
+		Entry.Type = Type;
+		Entry.BindIndex = Variable.BindIndex;
+		Entry.bBound = Variable.BindIndex >= 0;
+		Entry.bTyped = true;
+		Entry.PredictionRule = Variable.PredictionRule;
+		Entry.SimulationRule = Variable.SimulationRule;
+		Entry.EstimatedBits = EstimateSharedVariableBits(Type, Variable.CurrentValue);
+	} });
+
+	return true;
+}
+
+void UGMCE_CoreComponent::BindPendingTypedSharedVariables()
+{
+	PendingTypedSharedVariables.Sort([](const FGMCE_PendingTypedSharedVariable& A, const FGMCE_PendingTypedSharedVariable& B)
+	{
+		if (A.Type != B.Type) return A.Type < B.Type;
+		return A.VariableName.LexicalLess(B.VariableName);
+	});
+
+	TypedSharedVariableReport.Reset(PendingTypedSharedVariables.Num());
+	for (const FGMCE_PendingTypedSharedVariable& Pending : PendingTypedSharedVariables)
+	{
+		Pending.Bind();
+	}
+	PendingTypedSharedVariables.Empty();
+}
 
 // ---- Shared Variables: Bool
 #pragma region
-
 void UGMCE_CoreComponent::MakeSharedBool(const FName& VariableName, bool DefaultValue,
-                                         EGMC_PredictionMode PredictionRule, EGMC_CombineMode CombineRule,
-                                         EGMC_SimulationMode SimulationRule,
-                                         EGMC_InterpolationFunction InterpolationRule)
+                                   EGMC_PredictionMode PredictionRule, EGMC_CombineMode CombineRule,
+                                   EGMC_SimulationMode SimulationRule,
+                                   EGMC_InterpolationFunction InterpolationRule)
 {
-	if (!SharedVariables_Bool.Contains(VariableName))
+	if (!CanMakeSharedVariable(VariableName)) return;
+
+	if (SharedVariables_Bool.FindSlot(VariableName) == INDEX_NONE)
+	{
+		auto& Variable = SharedVariables_Bool.Add(VariableName, DefaultValue);
+		Variable.PredictionRule = PredictionRule;
+		Variable.CombineRule = CombineRule;
+		Variable.SimulationRule = SimulationRule;
+		Variable.InterpolationRule = InterpolationRule;
+	}
+	else
 	{
-		SharedVariables_Bool.Add(VariableName, TGMCE_SharedVariable<bool>(VariableName, DefaultValue));
-		const auto Variable = SharedVariables_Bool.Find(VariableName);
-		Variable->PredictionRule = PredictionRule;
-		Variable->CombineRule = CombineRule;
-		Variable->SimulationRule = SimulationRule;
-		Variable->InterpolationRule = InterpolationRule;
+		WarnIfSharedVariableRedefined(EGMCE_SharedVariableType::Bool, *SharedVariables_Bool.Find(VariableName), DefaultValue,
+			PredictionRule, CombineRule, SimulationRule, InterpolationRule);
 	}
 }
 
@@ -185,15 +940,19 @@ void UGMCE_CoreComponent::GetSharedBool(const FName& VariableName, bool& OutValu
 
 bool UGMCE_CoreComponent::GetSharedBool(const FName& VariableName, bool& OutValue)
 {
-	if (!SharedVariables_Bool.Contains(VariableName)) return false;
+	const int32 Slot = SharedVariables_Bool.FindSlot(VariableName);
+	if (Slot == INDEX_NONE) return false;
 
-	if (const auto Variable = SharedVariables_Bool.Find(VariableName))
-	{
-		OutValue = Variable->CurrentValue;
-		return true;
-	}
+	OutValue = ReadSharedBool(Slot);
+	return true;
+}
 
-	return false;
+bool UGMCE_CoreComponent::GetSharedBool(const FGMCE_SharedVariableHandle& Handle, bool& OutValue) const
+{
+	if (Handle.Type != EGMCE_SharedVariableType::Bool || !SharedVariables_Bool.IsValidSlot(Handle.Slot)) return false;
+
+	OutValue = ReadSharedBool(Handle.Slot);
+	return true;
 }
 
 void UGMCE_CoreComponent::SetSharedBool(const FName& VariableName, bool NewValue, bool& bOutSuccess)
@@ -203,38 +962,175 @@ void UGMCE_CoreComponent::SetSharedBool(const FName& VariableName, bool NewValue
 
 bool UGMCE_CoreComponent::SetSharedBool(const FName& VariableName, bool NewValue)
 {
-	if (!SharedVariables_Bool.Contains(VariableName)) return false;
+	const int32 Slot = SharedVariables_Bool.FindSlot(VariableName);
+	if (Slot == INDEX_NONE) return false;
+
+	WriteSharedBool(Slot, NewValue);
+	return true;
+}
 
-	if (const auto Variable = SharedVariables_Bool.Find(VariableName))
+bool UGMCE_CoreComponent::SetSharedBool(const FGMCE_SharedVariableHandle& Handle, bool NewValue)
+{
+	if (Handle.Type != EGMCE_SharedVariableType::Bool || !SharedVariables_Bool.IsValidSlot(Handle.Slot)) return false;
+
+	WriteSharedBool(Handle.Slot, NewValue);
+	return true;
+}
+
+void UGMCE_CoreComponent::BindSharedBoolVariables()
+{
+	const TArray<int32> BindOrder = SharedVariables_Bool.GetBindOrder();
+	PackedBoolLocations.Init(INDEX_NONE, SharedVariables_Bool.Num());
+
+	if (bPackSharedBools)
 	{
-		Variable->CurrentValue = NewValue;
-		return true;
+		// Group variables by replication rules, in bind order, so that both sides of the connection arrive at the
+		// same words. Interpolating a packed word would blend unrelated flags, so only nearest-neighbour variables
+		// are eligible.
+		TArray<TArray<int32>> Groups;
+		for (const int32 Slot : BindOrder)
+		{
+			const auto& Variable = SharedVariables_Bool.Variables[Slot];
+			if (Variable.InterpolationRule != EGMC_InterpolationFunction::NearestNeighbour) continue;
+
+			TArray<int32>* Group = Groups.FindByPredicate([&](const TArray<int32>& Candidate)
+			{
+				const auto& First = SharedVariables_Bool.Variables[Candidate[0]];
+				return First.PredictionRule == Variable.PredictionRule && First.CombineRule == Variable.CombineRule &&
+					First.SimulationRule == Variable.SimulationRule;
+			});
+			if (Group) { Group->Add(Slot); } else { Groups.Add({ Slot }); }
+		}
+
+		// A word costs 32 bits and an Int binding however full it is, so a group's last, partial word is only
+		// packed if it's full enough; the variables left over are bound one by one below.
+		const int32 MinGroupSize = FMath::Clamp(SharedBoolPackingMinGroupSize, 2, 32);
+		for (TArray<int32>& Group : Groups)
+		{
+			const int32 Remainder = Group.Num() % 32;
+			if (Remainder > 0 && Remainder < MinGroupSize) Group.SetNum(Group.Num() - Remainder);
+		}
+		Groups.RemoveAll([](const TArray<int32>& Group) { return Group.IsEmpty(); });
+
+		int32 WordCount = 0;
+		for (const auto& Group : Groups)
+		{
+			WordCount += FMath::DivideAndRoundUp(Group.Num(), 32);
+		}
+
+		// GMC holds a reference to each bound word, so the array must be sized exactly once.
+		PackedSharedBools.SetNum(WordCount);
+		PackedBoolSlots.Init(INDEX_NONE, WordCount * 32);
+
+		int32 Word = 0;
+		for (const auto& Group : Groups)
+		{
+			for (int32 Start = 0; Start < Group.Num(); Start += 32, Word++)
+			{
+				auto& Packed = PackedSharedBools[Word];
+				const int32 Count = FMath::Min(32, Group.Num() - Start);
+				for (int32 Bit = 0; Bit < Count; Bit++)
+				{
+					const int32 Slot = Group[Start + Bit];
+					PackedBoolLocations[Slot] = Word * 32 + Bit;
+					PackedBoolSlots[Word * 32 + Bit] = Slot;
+					if (SharedVariables_Bool.Variables[Slot].CurrentValue)
+					{
+						Packed.Bits |= static_cast<int32>(1u << Bit);
+					}
+				}
+				Packed.LastBits = Packed.Bits;
+
+				const auto& First = SharedVariables_Bool.Variables[Group[Start]];
+				Packed.BindIndex = BindInt(
+					Packed.Bits,
+					First.PredictionRule,
+					First.CombineRule,
+					First.SimulationRule,
+					EGMC_InterpolationFunction::NearestNeighbour
+				);
+
+				for (int32 Bit = 0; Bit < Count; Bit++)
+				{
+					const int32 Slot = Group[Start + Bit];
+					SharedVariables_Bool.Variables[Slot].BindIndex = Packed.BindIndex;
+					if (Packed.BindIndex < 0)
+					{
+						LogFailedSharedVariableBind(EGMCE_SharedVariableType::Bool, SharedVariables_Bool.Variables[Slot].VariableName);
+						SharedVariables_Bool.Retire(Slot);
+					}
+				}
+			}
+		}
 	}
 
-	return false;
+	for (const int32 Slot : BindOrder)
+	{
+		if (PackedBoolLocations[Slot] != INDEX_NONE) continue;
+
+		auto& Variable = SharedVariables_Bool.Variables[Slot];
+		Variable.BindIndex = BindBool(
+			Variable.CurrentValue,
+			Variable.PredictionRule,
+			Variable.CombineRule,
+			Variable.SimulationRule,
+			Variable.InterpolationRule
+		);
+
+		if (Variable.BindIndex < 0)
+		{
+			LogFailedSharedVariableBind(EGMCE_SharedVariableType::Bool, Variable.VariableName);
+			SharedVariables_Bool.Retire(Slot);
+		}
+	}
 }
 
-void UGMCE_CoreComponent::BindSharedBoolVariables()
+bool UGMCE_CoreComponent::BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::Bool>& Variable)
+{
+	return BindTypedSharedVariable(Variable, [this](auto&&... Args) { return BindBool(Forward<decltype(Args)>(Args)...); });
+}
+
+bool UGMCE_CoreComponent::ReadSharedBool(int32 Slot) const
+{
+	const int32 Location = PackedBoolLocations.IsValidIndex(Slot) ? PackedBoolLocations[Slot] : INDEX_NONE;
+	if (Location == INDEX_NONE) return SharedVariables_Bool.Variables[Slot].CurrentValue;
+
+	// GMC may have written the packed word since it was last unpacked, so it is the authoritative copy.
+	return (static_cast<uint32>(PackedSharedBools[Location / 32].Bits) & (1u << (Location % 32))) != 0;
+}
+
+void UGMCE_CoreComponent::WriteSharedBool(int32 Slot, bool NewValue)
 {
-	TArray<FName> Names;
-	SharedVariables_Bool.GenerateKeyArray(Names);
-	Names.Sort([](const FName& A, const FName& B){ return A.FastLess(B); });
+	SharedVariables_Bool.SetValue(Slot, NewValue);
+
+	const int32 Location = PackedBoolLocations.IsValidIndex(Slot) ? PackedBoolLocations[Slot] : INDEX_NONE;
+	if (Location == INDEX_NONE) return;
+
+	auto& Packed = PackedSharedBools[Location / 32];
+	const uint32 Mask = 1u << (Location % 32);
+	Packed.Bits = static_cast<int32>(NewValue ? (static_cast<uint32>(Packed.Bits) | Mask) : (static_cast<uint32>(Packed.Bits) & ~Mask));
+
+	// Only this bit is known to be in sync; other bits may still hold changes from GMC awaiting an unpack.
+	Packed.LastBits = static_cast<int32>((static_cast<uint32>(Packed.LastBits) & ~Mask) | (static_cast<uint32>(Packed.Bits) & Mask));
+}
 
-	for (FName& VariableName : Names)
+void UGMCE_CoreComponent::UnpackSharedBools()
+{
+	for (int32 Word = 0; Word < PackedSharedBools.Num(); Word++)
 	{
-		if (const auto Variable = SharedVariables_Bool.Find(VariableName))
+		auto& Packed = PackedSharedBools[Word];
+		uint32 Changed = static_cast<uint32>(Packed.Bits ^ Packed.LastBits);
+		Packed.LastBits = Packed.Bits;
+
+		while (Changed)
 		{
-			Variable->BindIndex = BindBool(
-				Variable->CurrentValue,
-				Variable->PredictionRule,
-				Variable->CombineRule,
-				Variable->SimulationRule,
-				Variable->InterpolationRule
-			);
-
-			if (Variable->BindIndex < 0)
+			const int32 Bit = FMath::CountTrailingZeros(Changed);
+			Changed &= Changed - 1;
+
+			const int32 Slot = PackedBoolSlots[Word * 32 + Bit];
+			if (Slot != INDEX_NONE)
 			{
-				SharedVariables_Bool.Remove(VariableName);
+				SharedVariables_Bool.SetValue(Slot, (static_cast<uint32>(Packed.Bits) & (1u << Bit)) != 0);
 			}
 		}
 	}
@@ -248,14 +1144,20 @@ void UGMCE_CoreComponent::MakeSharedHalfByte(const FName& VariableName, uint8 De
                                    EGMC_SimulationMode SimulationRule,
                                    EGMC_InterpolationFunction InterpolationRule)
 {
-	if (!SharedVariables_HalfByte.Contains(VariableName))
+	if (!CanMakeSharedVariable(VariableName)) return;
+
+	if (SharedVariables_HalfByte.FindSlot(VariableName) == INDEX_NONE)
+	{
+		auto& Variable = SharedVariables_HalfByte.Add(VariableName, DefaultValue);
+		Variable.PredictionRule = PredictionRule;
+		Variable.CombineRule = CombineRule;
+		Variable.SimulationRule = SimulationRule;
+		Variable.InterpolationRule = InterpolationRule;
+	}
+	else
 	{
-		SharedVariables_HalfByte.Add(VariableName, TGMCE_SharedVariable<uint8>(VariableName, DefaultValue));
-		const auto Variable = SharedVariables_HalfByte.Find(VariableName);
-		Variable->PredictionRule = PredictionRule;
-		Variable->CombineRule = CombineRule;
-		Variable->SimulationRule = SimulationRule;
-		Variable->InterpolationRule = InterpolationRule;
+		WarnIfSharedVariableRedefined(EGMCE_SharedVariableType::HalfByte, *SharedVariables_HalfByte.Find(VariableName), DefaultValue,
+			PredictionRule, CombineRule, SimulationRule, InterpolationRule);
 	}
 }
 
@@ -266,8 +1168,6 @@ void UGMCE_CoreComponent::GetSharedHalfByte(const FName& VariableName, uint8& Ou
 
 bool UGMCE_CoreComponent::GetSharedHalfByte(const FName& VariableName, uint8& OutValue)
 {
-	if (!SharedVariables_HalfByte.Contains(VariableName)) return false;
-
 	if (const auto Variable = SharedVariables_HalfByte.Find(VariableName))
 	{
 		OutValue = Variable->CurrentValue;
@@ -277,6 +1177,14 @@ bool UGMCE_CoreComponent::GetSharedHalfByte(const FName& VariableName, uint8& Ou
 	return false;
 }
 
+bool UGMCE_CoreComponent::GetSharedHalfByte(const FGMCE_SharedVariableHandle& Handle, uint8& OutValue) const
+{
+	if (Handle.Type != EGMCE_SharedVariableType::HalfByte || !SharedVariables_HalfByte.IsValidSlot(Handle.Slot)) return false;
+
+	OutValue = SharedVariables_HalfByte.Variables[Handle.Slot].CurrentValue;
+	return true;
+}
+
 void UGMCE_CoreComponent::SetSharedHalfByte(const FName& VariableName, uint8 NewValue, bool& bOutSuccess)
 {
 	bOutSuccess = SetSharedHalfByte(VariableName, NewValue);
@@ -284,41 +1192,46 @@ void UGMCE_CoreComponent::SetSharedHalfByte(const FName& VariableName, uint8 New
 
 bool UGMCE_CoreComponent::SetSharedHalfByte(const FName& VariableName, uint8 NewValue)
 {
-	if (!SharedVariables_HalfByte.Contains(VariableName)) return false;
+	const int32 Slot = SharedVariables_HalfByte.FindSlot(VariableName);
+	if (Slot == INDEX_NONE) return false;
 
-	if (const auto Variable = SharedVariables_HalfByte.Find(VariableName))
-	{
-		Variable->CurrentValue = NewValue;
-		return true;
-	}
+	SharedVariables_HalfByte.SetValue(Slot, NewValue);
+	return true;
+}
 
-	return false;
+bool UGMCE_CoreComponent::SetSharedHalfByte(const FGMCE_SharedVariableHandle& Handle, uint8 NewValue)
+{
+	if (Handle.Type != EGMCE_SharedVariableType::HalfByte || !SharedVariables_HalfByte.IsValidSlot(Handle.Slot)) return false;
+
+	SharedVariables_HalfByte.SetValue(Handle.Slot, NewValue);
+	return true;
 }
 
 void UGMCE_CoreComponent::BindSharedHalfByteVariables()
 {
-	TArray<FName> Names;
-	SharedVariables_HalfByte.GenerateKeyArray(Names);
-	Names.Sort([](const FName& A, const FName& B){ return A.FastLess(B); });
-	for (FName& VariableName : Names)
+	for (const int32 Slot : SharedVariables_HalfByte.GetBindOrder())
 	{
-		if (const auto Variable = SharedVariables_HalfByte.Find(VariableName))
+		auto& Variable = SharedVariables_HalfByte.Variables[Slot];
+		Variable.BindIndex = BindHalfByte(
+			Variable.CurrentValue,
+			Variable.PredictionRule,
+			Variable.CombineRule,
+			Variable.SimulationRule,
+			Variable.InterpolationRule
+		);
+
+		if (Variable.BindIndex < 0)
 		{
-			Variable->BindIndex = BindHalfByte(
-				Variable->CurrentValue,
-				Variable->PredictionRule,
-				Variable->CombineRule,
-				Variable->SimulationRule,
-				Variable->InterpolationRule
-			);
-
-			if (Variable->BindIndex < 0)
-			{
-				SharedVariables_HalfByte.Remove(VariableName);
-			}
+			LogFailedSharedVariableBind(EGMCE_SharedVariableType::HalfByte, Variable.VariableName);
+			SharedVariables_HalfByte.Retire(Slot);
 		}
 	}
 }
+
+bool UGMCE_CoreComponent::BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::HalfByte>& Variable)
+{
+	return BindTypedSharedVariable(Variable, [this](auto&&... Args) { return BindHalfByte(Forward<decltype(Args)>(Args)...); });
+}
 #pragma endregion
 
 // ---- Shared Variables: Byte
@@ -328,14 +1241,20 @@ void UGMCE_CoreComponent::MakeSharedByte(const FName& VariableName, uint8 Defaul
                                    EGMC_SimulationMode SimulationRule,
                                    EGMC_InterpolationFunction InterpolationRule)
 {
-	if (!SharedVariables_Byte.Contains(VariableName))
+	if (!CanMakeSharedVariable(VariableName)) return;
+
+	if (SharedVariables_Byte.FindSlot(VariableName) == INDEX_NONE)
 	{
-		SharedVariables_Byte.Add(VariableName, TGMCE_SharedVariable<uint8>(VariableName, DefaultValue));
-		const auto Variable = SharedVariables_Byte.Find(VariableName);
-		Variable->PredictionRule = PredictionRule;
-		Variable->CombineRule = CombineRule;
-		Variable->SimulationRule = SimulationRule;
-		Variable->InterpolationRule = InterpolationRule;
+		auto& Variable = SharedVariables_Byte.Add(VariableName, DefaultValue);
+		Variable.PredictionRule = PredictionRule;
+		Variable.CombineRule = CombineRule;
+		Variable.SimulationRule = SimulationRule;
+		Variable.InterpolationRule = InterpolationRule;
+	}
+	else
+	{
+		WarnIfSharedVariableRedefined(EGMCE_SharedVariableType::Byte, *SharedVariables_Byte.Find(VariableName), DefaultValue,
+			PredictionRule, CombineRule, SimulationRule, InterpolationRule);
 	}
 }
 
@@ -346,8 +1265,6 @@ void UGMCE_CoreComponent::GetSharedByte(const FName& VariableName, uint8& OutVal
 
 bool UGMCE_CoreComponent::GetSharedByte(const FName& VariableName, uint8& OutValue)
 {
-	if (!SharedVariables_Byte.Contains(VariableName)) return false;
-
 	if (const auto Variable = SharedVariables_Byte.Find(VariableName))
 	{
 		OutValue = Variable->CurrentValue;
@@ -357,6 +1274,14 @@ bool UGMCE_CoreComponent::GetSharedByte(const FName& VariableName, uint8& OutVal
 	return false;
 }
 
+bool UGMCE_CoreComponent::GetSharedByte(const FGMCE_SharedVariableHandle& Handle, uint8& OutValue) const
+{
+	if (Handle.Type != EGMCE_SharedVariableType::Byte || !SharedVariables_Byte.IsValidSlot(Handle.Slot)) return false;
+
+	OutValue = SharedVariables_Byte.Variables[Handle.Slot].CurrentValue;
+	return true;
+}
+
 void UGMCE_CoreComponent::SetSharedByte(const FName& VariableName, uint8 NewValue, bool& bOutSuccess)
 {
 	bOutSuccess = SetSharedByte(VariableName, NewValue);
@@ -364,41 +1289,46 @@ void UGMCE_CoreComponent::SetSharedByte(const FName& VariableName, uint8 NewValu
 
 bool UGMCE_CoreComponent::SetSharedByte(const FName& VariableName, uint8 NewValue)
 {
-	if (!SharedVariables_Byte.Contains(VariableName)) return false;
+	const int32 Slot = SharedVariables_Byte.FindSlot(VariableName);
+	if (Slot == INDEX_NONE) return false;
 
-	if (const auto Variable = SharedVariables_Byte.Find(VariableName))
-	{
-		Variable->CurrentValue = NewValue;
-		return true;
-	}
+	SharedVariables_Byte.SetValue(Slot, NewValue);
+	return true;
+}
 
-	return false;
+bool UGMCE_CoreComponent::SetSharedByte(const FGMCE_SharedVariableHandle& Handle, uint8 NewValue)
+{
+	if (Handle.Type != EGMCE_SharedVariableType::Byte || !SharedVariables_Byte.IsValidSlot(Handle.Slot)) return false;
+
+	SharedVariables_Byte.SetValue(Handle.Slot, NewValue);
+	return true;
 }
 
 void UGMCE_CoreComponent::BindSharedByteVariables()
 {
-	TArray<FName> Names;
-	SharedVariables_Byte.GenerateKeyArray(Names);
-	Names.Sort([](const FName& A, const FName& B){ return A.FastLess(B); });
-	for (FName& VariableName : Names)
+	for (const int32 Slot : SharedVariables_Byte.GetBindOrder())
 	{
-		if (const auto Variable = SharedVariables_Byte.Find(VariableName))
+		auto& Variable = SharedVariables_Byte.Variables[Slot];
+		Variable.BindIndex = BindByte(
+			Variable.CurrentValue,
+			Variable.PredictionRule,
+			Variable.CombineRule,
+			Variable.SimulationRule,
+			Variable.InterpolationRule
+		);
+
+		if (Variable.BindIndex < 0)
 		{
-			Variable->BindIndex = BindByte(
-				Variable->CurrentValue,
-				Variable->PredictionRule,
-				Variable->CombineRule,
-				Variable->SimulationRule,
-				Variable->InterpolationRule
-			);
-
-			if (Variable->BindIndex < 0)
-			{
-				SharedVariables_Byte.Remove(VariableName);
-			}
+			LogFailedSharedVariableBind(EGMCE_SharedVariableType::Byte, Variable.VariableName);
+			SharedVariables_Byte.Retire(Slot);
 		}
 	}
 }
+
+bool UGMCE_CoreComponent::BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::Byte>& Variable)
+{
+	return BindTypedSharedVariable(Variable, [this](auto&&... Args) { return BindByte(Forward<decltype(Args)>(Args)...); });
+}
 #pragma endregion
 
 // ---- Shared Variables: Int
@@ -408,14 +1338,20 @@ void UGMCE_CoreComponent::MakeSharedInt(const FName& VariableName, int32 Default
                                    EGMC_SimulationMode SimulationRule,
                                    EGMC_InterpolationFunction InterpolationRule)
 {
-	if (!SharedVariables_Int.Contains(VariableName))
+	if (!CanMakeSharedVariable(VariableName)) return;
+
+	if (SharedVariables_Int.FindSlot(VariableName) == INDEX_NONE)
 	{
-		SharedVariables_Int.Add(VariableName, TGMCE_SharedVariable<int32>(VariableName, DefaultValue));
-		const auto Variable = SharedVariables_Int.Find(VariableName);
-		Variable->PredictionRule = PredictionRule;
-		Variable->CombineRule = CombineRule;
-		Variable->SimulationRule = SimulationRule;
-		Variable->InterpolationRule = InterpolationRule;
+		auto& Variable = SharedVariables_Int.Add(VariableName, DefaultValue);
+		Variable.PredictionRule = PredictionRule;
+		Variable.CombineRule = CombineRule;
+		Variable.SimulationRule = SimulationRule;
+		Variable.InterpolationRule = InterpolationRule;
+	}
+	else
+	{
+		WarnIfSharedVariableRedefined(EGMCE_SharedVariableType::Int, *SharedVariables_Int.Find(VariableName), DefaultValue,
+			PredictionRule, CombineRule, SimulationRule, InterpolationRule);
 	}
 }
 
@@ -426,8 +1362,6 @@ void UGMCE_CoreComponent::GetSharedInt(const FName& VariableName, int32& OutValu
 
 bool UGMCE_CoreComponent::GetSharedInt(const FName& VariableName, int32& OutValue)
 {
-	if (!SharedVariables_Int.Contains(VariableName)) return false;
-
 	if (const auto Variable = SharedVariables_Int.Find(VariableName))
 	{
 		OutValue = Variable->CurrentValue;
@@ -437,6 +1371,14 @@ bool UGMCE_CoreComponent::GetSharedInt(const FName& VariableName, int32& OutValu
 	return false;
 }
 
+bool UGMCE_CoreComponent::GetSharedInt(const FGMCE_SharedVariableHandle& Handle, int32& OutValue) const
+{
+	if (Handle.Type != EGMCE_SharedVariableType::Int || !SharedVariables_Int.IsValidSlot(Handle.Slot)) return false;
+
+	OutValue = SharedVariables_Int.Variables[Handle.Slot].CurrentValue;
+	return true;
+}
+
 void UGMCE_CoreComponent::SetSharedInt(const FName& VariableName, int32 NewValue, bool& bOutSuccess)
 {
 	bOutSuccess = SetSharedInt(VariableName, NewValue);
@@ -444,41 +1386,46 @@ void UGMCE_CoreComponent::SetSharedInt(const FName& VariableName, int32 NewValue
 
 bool UGMCE_CoreComponent::SetSharedInt(const FName& VariableName, int32 NewValue)
 {
-	if (!SharedVariables_Int.Contains(VariableName)) return false;
+	const int32 Slot = SharedVariables_Int.FindSlot(VariableName);
+	if (Slot == INDEX_NONE) return false;
 
-	if (const auto Variable = SharedVariables_Int.Find(VariableName))
-	{
-		Variable->CurrentValue = NewValue;
-		return true;
-	}
+	SharedVariables_Int.SetValue(Slot, NewValue);
+	return true;
+}
 
-	return false;
+bool UGMCE_CoreComponent::SetSharedInt(const FGMCE_SharedVariableHandle& Handle, int32 NewValue)
+{
+	if (Handle.Type != EGMCE_SharedVariableType::Int || !SharedVariables_Int.IsValidSlot(Handle.Slot)) return false;
+
+	SharedVariables_Int.SetValue(Handle.Slot, NewValue);
+	return true;
 }
 
 void UGMCE_CoreComponent::BindSharedIntVariables()
 {
-	TArray<FName> Names;
-	SharedVariables_Int.GenerateKeyArray(Names);
-	Names.Sort([](const FName& A, const FName& B){ return A.FastLess(B); });
-	for (FName& VariableName : Names)
+	for (const int32 Slot : SharedVariables_Int.GetBindOrder())
 	{
-		if (const auto Variable = SharedVariables_Int.Find(VariableName))
+		auto& Variable = SharedVariables_Int.Variables[Slot];
+		Variable.BindIndex = BindInt(
+			Variable.CurrentValue,
+			Variable.PredictionRule,
+			Variable.CombineRule,
+			Variable.SimulationRule,
+			Variable.InterpolationRule
+		);
+
+		if (Variable.BindIndex < 0)
 		{
-			Variable->BindIndex = BindInt(
-				Variable->CurrentValue,
-				Variable->PredictionRule,
-				Variable->CombineRule,
-				Variable->SimulationRule,
-				Variable->InterpolationRule
-			);
-
-			if (Variable->BindIndex < 0)
-			{
-				SharedVariables_Int.Remove(VariableName);
-			}
+			LogFailedSharedVariableBind(EGMCE_SharedVariableType::Int, Variable.VariableName);
+			SharedVariables_Int.Retire(Slot);
 		}
 	}
 }
+
+bool UGMCE_CoreComponent::BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::Int>& Variable)
+{
+	return BindTypedSharedVariable(Variable, [this](auto&&... Args) { return BindInt(Forward<decltype(Args)>(Args)...); });
+}
 #pragma endregion
 
 // ---- Shared Variables: SinglePrecisionFloat
@@ -488,14 +1435,20 @@ void UGMCE_CoreComponent::MakeSharedSinglePrecisionFloat(const FName& VariableNa
                                    EGMC_SimulationMode SimulationRule,
                                    EGMC_InterpolationFunction InterpolationRule)
 {
-	if (!SharedVariables_SinglePrecisionFloat.Contains(VariableName))
+	if (!CanMakeSharedVariable(VariableName)) return;
+
+	if (SharedVariables_SinglePrecisionFloat.FindSlot(VariableName) == INDEX_NONE)
+	{
+		auto& Variable = SharedVariables_SinglePrecisionFloat.Add(VariableName, DefaultValue);
+		Variable.PredictionRule = PredictionRule;
+		Variable.CombineRule = CombineRule;
+		Variable.SimulationRule = SimulationRule;
+		Variable.InterpolationRule = InterpolationRule;
+	}
+	else
 	{
-		SharedVariables_SinglePrecisionFloat.Add(VariableName, TGMCE_SharedVariable<float>(VariableName, DefaultValue));
-		const auto Variable = SharedVariables_SinglePrecisionFloat.Find(VariableName);
-		Variable->PredictionRule = PredictionRule;
-		Variable->CombineRule = CombineRule;
-		Variable->SimulationRule = SimulationRule;
-		Variable->InterpolationRule = InterpolationRule;
+		WarnIfSharedVariableRedefined(EGMCE_SharedVariableType::SinglePrecisionFloat, *SharedVariables_SinglePrecisionFloat.Find(VariableName), DefaultValue,
+			PredictionRule, CombineRule, SimulationRule, InterpolationRule);
 	}
 }
 
@@ -506,8 +1459,6 @@ void UGMCE_CoreComponent::GetSharedSinglePrecisionFloat(const FName& VariableNam
 
 bool UGMCE_CoreComponent::GetSharedSinglePrecisionFloat(const FName& VariableName, float& OutValue)
 {
-	if (!SharedVariables_SinglePrecisionFloat.Contains(VariableName)) return false;
-
 	if (const auto Variable = SharedVariables_SinglePrecisionFloat.Find(VariableName))
 	{
 		OutValue = Variable->CurrentValue;
@@ -517,6 +1468,14 @@ bool UGMCE_CoreComponent::GetSharedSinglePrecisionFloat(const FName& VariableNam
 	return false;
 }
 
+bool UGMCE_CoreComponent::GetSharedSinglePrecisionFloat(const FGMCE_SharedVariableHandle& Handle, float& OutValue) const
+{
+	if (Handle.Type != EGMCE_SharedVariableType::SinglePrecisionFloat || !SharedVariables_SinglePrecisionFloat.IsValidSlot(Handle.Slot)) return false;
+
+	OutValue = SharedVariables_SinglePrecisionFloat.Variables[Handle.Slot].CurrentValue;
+	return true;
+}
+
 void UGMCE_CoreComponent::SetSharedSinglePrecisionFloat(const FName& VariableName, float NewValue, bool& bOutSuccess)
 {
 	bOutSuccess = SetSharedSinglePrecisionFloat(VariableName, NewValue);
@@ -524,41 +1483,46 @@ void UGMCE_CoreComponent::SetSharedSinglePrecisionFloat(const FName& VariableNam
 
 bool UGMCE_CoreComponent::SetSharedSinglePrecisionFloat(const FName& VariableName, float NewValue)
 {
-	if (!SharedVariables_SinglePrecisionFloat.Contains(VariableName)) return false;
+	const int32 Slot = SharedVariables_SinglePrecisionFloat.FindSlot(VariableName);
+	if (Slot == INDEX_NONE) return false;
 
-	if (const auto Variable = SharedVariables_SinglePrecisionFloat.Find(VariableName))
-	{
-		Variable->CurrentValue = NewValue;
-		return true;
-	}
+	SharedVariables_SinglePrecisionFloat.SetValue(Slot, NewValue);
+	return true;
+}
 
-	return false;
+bool UGMCE_CoreComponent::SetSharedSinglePrecisionFloat(const FGMCE_SharedVariableHandle& Handle, float NewValue)
+{
+	if (Handle.Type != EGMCE_SharedVariableType::SinglePrecisionFloat || !SharedVariables_SinglePrecisionFloat.IsValidSlot(Handle.Slot)) return false;
+
+	SharedVariables_SinglePrecisionFloat.SetValue(Handle.Slot, NewValue);
+	return true;
 }
 
 void UGMCE_CoreComponent::BindSharedSinglePrecisionFloatVariables()
 {
-	TArray<FName> Names;
-	SharedVariables_SinglePrecisionFloat.GenerateKeyArray(Names);
-	Names.Sort([](const FName& A, const FName& B){ return A.FastLess(B); });
-	for (FName& VariableName : Names)
+	for (const int32 Slot : SharedVariables_SinglePrecisionFloat.GetBindOrder())
 	{
-		if (const auto Variable = SharedVariables_SinglePrecisionFloat.Find(VariableName))
+		auto& Variable = SharedVariables_SinglePrecisionFloat.Variables[Slot];
+		Variable.BindIndex = BindSinglePrecisionFloat(
+			Variable.CurrentValue,
+			Variable.PredictionRule,
+			Variable.CombineRule,
+			Variable.SimulationRule,
+			Variable.InterpolationRule
+		);
+
+		if (Variable.BindIndex < 0)
 		{
-			Variable->BindIndex = BindSinglePrecisionFloat(
-				Variable->CurrentValue,
-				Variable->PredictionRule,
-				Variable->CombineRule,
-				Variable->SimulationRule,
-				Variable->InterpolationRule
-			);
-
-			if (Variable->BindIndex < 0)
-			{
-				SharedVariables_SinglePrecisionFloat.Remove(VariableName);
-			}
+			LogFailedSharedVariableBind(EGMCE_SharedVariableType::SinglePrecisionFloat, Variable.VariableName);
+			SharedVariables_SinglePrecisionFloat.Retire(Slot);
 		}
 	}
 }
+
+bool UGMCE_CoreComponent::BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::SinglePrecisionFloat>& Variable)
+{
+	return BindTypedSharedVariable(Variable, [this](auto&&... Args) { return BindSinglePrecisionFloat(Forward<decltype(Args)>(Args)...); });
+}
 #pragma endregion
 
 // ---- Shared Variables: CompressedSinglePrecisionFloat
@@ -568,14 +1532,20 @@ void UGMCE_CoreComponent::MakeSharedCompressedSinglePrecisionFloat(const FName&
                                    EGMC_SimulationMode SimulationRule,
                                    EGMC_InterpolationFunction InterpolationRule)
 {
-	if (!SharedVariables_CompressedSinglePrecisionFloat.Contains(VariableName))
+	if (!CanMakeSharedVariable(VariableName)) return;
+
+	if (SharedVariables_CompressedSinglePrecisionFloat.FindSlot(VariableName) == INDEX_NONE)
+	{
+		auto& Variable = SharedVariables_CompressedSinglePrecisionFloat.Add(VariableName, DefaultValue);
+		Variable.PredictionRule = PredictionRule;
+		Variable.CombineRule = CombineRule;
+		Variable.SimulationRule = SimulationRule;
+		Variable.InterpolationRule = InterpolationRule;
+	}
+	else
 	{
-		SharedVariables_CompressedSinglePrecisionFloat.Add(VariableName, TGMCE_SharedVariable<float>(VariableName, DefaultValue));
-		const auto Variable = SharedVariables_CompressedSinglePrecisionFloat.Find(VariableName);
-		Variable->PredictionRule = PredictionRule;
-		Variable->CombineRule = CombineRule;
-		Variable->SimulationRule = SimulationRule;
-		Variable->InterpolationRule = InterpolationRule;
+		WarnIfSharedVariableRedefined(EGMCE_SharedVariableType::CompressedSinglePrecisionFloat, *SharedVariables_CompressedSinglePrecisionFloat.Find(VariableName), DefaultValue,
+			PredictionRule, CombineRule, SimulationRule, InterpolationRule);
 	}
 }
 
@@ -586,8 +1556,6 @@ void UGMCE_CoreComponent::GetSharedCompressedSinglePrecisionFloat(const FName& V
 
 bool UGMCE_CoreComponent::GetSharedCompressedSinglePrecisionFloat(const FName& VariableName, float& OutValue)
 {
-	if (!SharedVariables_CompressedSinglePrecisionFloat.Contains(VariableName)) return false;
-
 	if (const auto Variable = SharedVariables_CompressedSinglePrecisionFloat.Find(VariableName))
 	{
 		OutValue = Variable->CurrentValue;
@@ -597,6 +1565,14 @@ bool UGMCE_CoreComponent::GetSharedCompressedSinglePrecisionFloat(const FName& V
 	return false;
 }
 
+bool UGMCE_CoreComponent::GetSharedCompressedSinglePrecisionFloat(const FGMCE_SharedVariableHandle& Handle, float& OutValue) const
+{
+	if (Handle.Type != EGMCE_SharedVariableType::CompressedSinglePrecisionFloat || !SharedVariables_CompressedSinglePrecisionFloat.IsValidSlot(Handle.Slot)) return false;
+
+	OutValue = SharedVariables_CompressedSinglePrecisionFloat.Variables[Handle.Slot].CurrentValue;
+	return true;
+}
+
 void UGMCE_CoreComponent::SetSharedCompressedSinglePrecisionFloat(const FName& VariableName, float NewValue, bool& bOutSuccess)
 {
 	bOutSuccess = SetSharedCompressedSinglePrecisionFloat(VariableName, NewValue);
@@ -604,41 +1580,46 @@ void UGMCE_CoreComponent::SetSharedCompressedSinglePrecisionFloat(const FName& V
 
 bool UGMCE_CoreComponent::SetSharedCompressedSinglePrecisionFloat(const FName& VariableName, float NewValue)
 {
-	if (!SharedVariables_CompressedSinglePrecisionFloat.Contains(VariableName)) return false;
+	const int32 Slot = SharedVariables_CompressedSinglePrecisionFloat.FindSlot(VariableName);
+	if (Slot == INDEX_NONE) return false;
 
-	if (const auto Variable = SharedVariables_CompressedSinglePrecisionFloat.Find(VariableName))
-	{
-		Variable->CurrentValue = NewValue;
-		return true;
-	}
+	SharedVariables_CompressedSinglePrecisionFloat.SetValue(Slot, NewValue);
+	return true;
+}
 
-	return false;
+bool UGMCE_CoreComponent::SetSharedCompressedSinglePrecisionFloat(const FGMCE_SharedVariableHandle& Handle, float NewValue)
+{
+	if (Handle.Type != EGMCE_SharedVariableType::CompressedSinglePrecisionFloat || !SharedVariables_CompressedSinglePrecisionFloat.IsValidSlot(Handle.Slot)) return false;
+
+	SharedVariables_CompressedSinglePrecisionFloat.SetValue(Handle.Slot, NewValue);
+	return true;
 }
 
 void UGMCE_CoreComponent::BindSharedCompressedSinglePrecisionFloatVariables()
 {
-	TArray<FName> Names;
-	SharedVariables_CompressedSinglePrecisionFloat.GenerateKeyArray(Names);
-	Names.Sort([](const FName& A, const FName& B){ return A.FastLess(B); });
-	for (FName& VariableName : Names)
+	for (const int32 Slot : SharedVariables_CompressedSinglePrecisionFloat.GetBindOrder())
 	{
-		if (const auto Variable = SharedVariables_CompressedSinglePrecisionFloat.Find(VariableName))
+		auto& Variable = SharedVariables_CompressedSinglePrecisionFloat.Variables[Slot];
+		Variable.BindIndex = BindCompressedSinglePrecisionFloat(
+			Variable.CurrentValue,
+			Variable.PredictionRule,
+			Variable.CombineRule,
+			Variable.SimulationRule,
+			Variable.InterpolationRule
+		);
+
+		if (Variable.BindIndex < 0)
 		{
-			Variable->BindIndex = BindCompressedSinglePrecisionFloat(
-				Variable->CurrentValue,
-				Variable->PredictionRule,
-				Variable->CombineRule,
-				Variable->SimulationRule,
-				Variable->InterpolationRule
-			);
-
-			if (Variable->BindIndex < 0)
-			{
-				SharedVariables_CompressedSinglePrecisionFloat.Remove(VariableName);
-			}
+			LogFailedSharedVariableBind(EGMCE_SharedVariableType::CompressedSinglePrecisionFloat, Variable.VariableName);
+			SharedVariables_CompressedSinglePrecisionFloat.Retire(Slot);
 		}
 	}
 }
+
+bool UGMCE_CoreComponent::BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::CompressedSinglePrecisionFloat>& Variable)
+{
+	return BindTypedSharedVariable(Variable, [this](auto&&... Args) { return BindCompressedSinglePrecisionFloat(Forward<decltype(Args)>(Args)...); });
+}
 #pragma endregion
 
 // ---- Shared Variables: DoublePrecisionFloat
@@ -648,14 +1629,20 @@ void UGMCE_CoreComponent::MakeSharedDoublePrecisionFloat(const FName& VariableNa
                                    EGMC_SimulationMode SimulationRule,
                                    EGMC_InterpolationFunction InterpolationRule)
 {
-	if (!SharedVariables_DoublePrecisionFloat.Contains(VariableName))
+	if (!CanMakeSharedVariable(VariableName)) return;
+
+	if (SharedVariables_DoublePrecisionFloat.FindSlot(VariableName) == INDEX_NONE)
 	{
-		SharedVariables_DoublePrecisionFloat.Add(VariableName, TGMCE_SharedVariable<double>(VariableName, DefaultValue));
-		const auto Variable = SharedVariables_DoublePrecisionFloat.Find(VariableName);
-		Variable->PredictionRule = PredictionRule;
-		Variable->CombineRule = CombineRule;
-		Variable->SimulationRule = SimulationRule;
-		Variable->InterpolationRule = InterpolationRule;
+		auto& Variable = SharedVariables_DoublePrecisionFloat.Add(VariableName, DefaultValue);
+		Variable.PredictionRule = PredictionRule;
+		Variable.CombineRule = CombineRule;
+		Variable.SimulationRule = SimulationRule;
+		Variable.InterpolationRule = InterpolationRule;
+	}
+	else
+	{
+		WarnIfSharedVariableRedefined(EGMCE_SharedVariableType::DoublePrecisionFloat, *SharedVariables_DoublePrecisionFloat.Find(VariableName), DefaultValue,
+			PredictionRule, CombineRule, SimulationRule, InterpolationRule);
 	}
 }
 
@@ -666,8 +1653,6 @@ void UGMCE_CoreComponent::GetSharedDoublePrecisionFloat(const FName& VariableNam
 
 bool UGMCE_CoreComponent::GetSharedDoublePrecisionFloat(const FName& VariableName, double& OutValue)
 {
-	if (!SharedVariables_DoublePrecisionFloat.Contains(VariableName)) return false;
-
 	if (const auto Variable = SharedVariables_DoublePrecisionFloat.Find(VariableName))
 	{
 		OutValue = Variable->CurrentValue;
@@ -677,6 +1662,14 @@ bool UGMCE_CoreComponent::GetSharedDoublePrecisionFloat(const FName& VariableNam
 	return false;
 }
 
+bool UGMCE_CoreComponent::GetSharedDoublePrecisionFloat(const FGMCE_SharedVariableHandle& Handle, double& OutValue) const
+{
+	if (Handle.Type != EGMCE_SharedVariableType::DoublePrecisionFloat || !SharedVariables_DoublePrecisionFloat.IsValidSlot(Handle.Slot)) return false;
+
+	OutValue = SharedVariables_DoublePrecisionFloat.Variables[Handle.Slot].CurrentValue;
+	return true;
+}
+
 void UGMCE_CoreComponent::SetSharedDoublePrecisionFloat(const FName& VariableName, double NewValue, bool& bOutSuccess)
 {
 	bOutSuccess = SetSharedDoublePrecisionFloat(VariableName, NewValue);
@@ -684,42 +1677,46 @@ void UGMCE_CoreComponent::SetSharedDoublePrecisionFloat(const FName& VariableNam
 
 bool UGMCE_CoreComponent::SetSharedDoublePrecisionFloat(const FName& VariableName, double NewValue)
 {
-	if (!SharedVariables_DoublePrecisionFloat.Contains(VariableName)) return false;
+	const int32 Slot = SharedVariables_DoublePrecisionFloat.FindSlot(VariableName);
+	if (Slot == INDEX_NONE) return false;
 
-	if (const auto Variable = SharedVariables_DoublePrecisionFloat.Find(VariableName))
-	{
-		Variable->CurrentValue = NewValue;
-		return true;
-	}
+	SharedVariables_DoublePrecisionFloat.SetValue(Slot, NewValue);
+	return true;
+}
 
-	return false;
+bool UGMCE_CoreComponent::SetSharedDoublePrecisionFloat(const FGMCE_SharedVariableHandle& Handle, double NewValue)
+{
+	if (Handle.Type != EGMCE_SharedVariableType::DoublePrecisionFloat || !SharedVariables_DoublePrecisionFloat.IsValidSlot(Handle.Slot)) return false;
+
+	SharedVariables_DoublePrecisionFloat.SetValue(Handle.Slot, NewValue);
+	return true;
 }
 
 void UGMCE_CoreComponent::BindSharedDoublePrecisionFloatVariables()
 {
-	TArray<FName> Names;
-	SharedVariables_DoublePrecisionFloat.GenerateKeyArray(Names);
-	Names.Sort([](const FName& A, const FName& B){ return A.FastLess(B); });
-
-	for (FName& VariableName : Names)
+	for (const int32 Slot : SharedVariables_DoublePrecisionFloat.GetBindOrder())
 	{
-		if (const auto Variable = SharedVariables_DoublePrecisionFloat.Find(VariableName))
+		auto& Variable = SharedVariables_DoublePrecisionFloat.Variables[Slot];
+		Variable.BindIndex = BindDoublePrecisionFloat(
+			Variable.CurrentValue,
+			Variable.PredictionRule,
+			Variable.CombineRule,
+			Variable.SimulationRule,
+			Variable.InterpolationRule
+		);
+
+		if (Variable.BindIndex < 0)
 		{
-			Variable->BindIndex = BindDoublePrecisionFloat(
-				Variable->CurrentValue,
-				Variable->PredictionRule,
-				Variable->CombineRule,
-				Variable->SimulationRule,
-				Variable->InterpolationRule
-			);
-
-			if (Variable->BindIndex < 0)
-			{
-				SharedVariables_DoublePrecisionFloat.Remove(VariableName);
-			}
+			LogFailedSharedVariableBind(EGMCE_SharedVariableType::DoublePrecisionFloat, Variable.VariableName);
+			SharedVariables_DoublePrecisionFloat.Retire(Slot);
 		}
 	}
 }
+
+bool UGMCE_CoreComponent::BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::DoublePrecisionFloat>& Variable)
+{
+	return BindTypedSharedVariable(Variable, [this](auto&&... Args) { return BindDoublePrecisionFloat(Forward<decltype(Args)>(Args)...); });
+}
 #pragma endregion
 
 // ---- Shared Variables: CompressedDoublePrecisionFloat
@@ -729,14 +1726,20 @@ void UGMCE_CoreComponent::MakeSharedCompressedDoublePrecisionFloat(const FName&
                                    EGMC_SimulationMode SimulationRule,
                                    EGMC_InterpolationFunction InterpolationRule)
 {
-	if (!SharedVariables_CompressedDoublePrecisionFloat.Contains(VariableName))
+	if (!CanMakeSharedVariable(VariableName)) return;
+
+	if (SharedVariables_CompressedDoublePrecisionFloat.FindSlot(VariableName) == INDEX_NONE)
+	{
+		auto& Variable = SharedVariables_CompressedDoublePrecisionFloat.Add(VariableName, DefaultValue);
+		Variable.PredictionRule = PredictionRule;
+		Variable.CombineRule = CombineRule;
+		Variable.SimulationRule = SimulationRule;
+		Variable.InterpolationRule = InterpolationRule;
+	}
+	else
 	{
-		SharedVariables_CompressedDoublePrecisionFloat.Add(VariableName, TGMCE_SharedVariable<double>(VariableName, DefaultValue));
-		const auto Variable = SharedVariables_CompressedDoublePrecisionFloat.Find(VariableName);
-		Variable->PredictionRule = PredictionRule;
-		Variable->CombineRule = CombineRule;
-		Variable->SimulationRule = SimulationRule;
-		Variable->InterpolationRule = InterpolationRule;
+		WarnIfSharedVariableRedefined(EGMCE_SharedVariableType::CompressedDoublePrecisionFloat, *SharedVariables_CompressedDoublePrecisionFloat.Find(VariableName), DefaultValue,
+			PredictionRule, CombineRule, SimulationRule, InterpolationRule);
 	}
 }
 
@@ -747,8 +1750,6 @@ void UGMCE_CoreComponent::GetSharedCompressedDoublePrecisionFloat(const FName& V
 
 bool UGMCE_CoreComponent::GetSharedCompressedDoublePrecisionFloat(const FName& VariableName, double& OutValue)
 {
-	if (!SharedVariables_CompressedDoublePrecisionFloat.Contains(VariableName)) return false;
-
 	if (const auto Variable = SharedVariables_CompressedDoublePrecisionFloat.Find(VariableName))
 	{
 		OutValue = Variable->CurrentValue;
@@ -758,6 +1759,14 @@ bool UGMCE_CoreComponent::GetSharedCompressedDoublePrecisionFloat(const FName& V
 	return false;
 }
 
+bool UGMCE_CoreComponent::GetSharedCompressedDoublePrecisionFloat(const FGMCE_SharedVariableHandle& Handle, double& OutValue) const
+{
+	if (Handle.Type != EGMCE_SharedVariableType::CompressedDoublePrecisionFloat || !SharedVariables_CompressedDoublePrecisionFloat.IsValidSlot(Handle.Slot)) return false;
+
+	OutValue = SharedVariables_CompressedDoublePrecisionFloat.Variables[Handle.Slot].CurrentValue;
+	return true;
+}
+
 void UGMCE_CoreComponent::SetSharedCompressedDoublePrecisionFloat(const FName& VariableName, double NewValue, bool& bOutSuccess)
 {
 	bOutSuccess = SetSharedCompressedDoublePrecisionFloat(VariableName, NewValue);
@@ -765,42 +1774,46 @@ void UGMCE_CoreComponent::SetSharedCompressedDoublePrecisionFloat(const FName& V
 
 bool UGMCE_CoreComponent::SetSharedCompressedDoublePrecisionFloat(const FName& VariableName, double NewValue)
 {
-	if (!SharedVariables_CompressedDoublePrecisionFloat.Contains(VariableName)) return false;
+	const int32 Slot = SharedVariables_CompressedDoublePrecisionFloat.FindSlot(VariableName);
+	if (Slot == INDEX_NONE) return false;
 
-	if (const auto Variable = SharedVariables_CompressedDoublePrecisionFloat.Find(VariableName))
-	{
-		Variable->CurrentValue = NewValue;
-		return true;
-	}
+	SharedVariables_CompressedDoublePrecisionFloat.SetValue(Slot, NewValue);
+	return true;
+}
 
-	return false;
+bool UGMCE_CoreComponent::SetSharedCompressedDoublePrecisionFloat(const FGMCE_SharedVariableHandle& Handle, double NewValue)
+{
+	if (Handle.Type != EGMCE_SharedVariableType::CompressedDoublePrecisionFloat || !SharedVariables_CompressedDoublePrecisionFloat.IsValidSlot(Handle.Slot)) return false;
+
+	SharedVariables_CompressedDoublePrecisionFloat.SetValue(Handle.Slot, NewValue);
+	return true;
 }
 
 void UGMCE_CoreComponent::BindSharedCompressedDoublePrecisionFloatVariables()
 {
-	TArray<FName> Names;
-	SharedVariables_CompressedDoublePrecisionFloat.GenerateKeyArray(Names);
-	Names.Sort([](const FName& A, const FName& B){ return A.FastLess(B); });
-
-	for (FName& VariableName : Names)
+	for (const int32 Slot : SharedVariables_CompressedDoublePrecisionFloat.GetBindOrder())
 	{
-		if (const auto Variable = SharedVariables_CompressedDoublePrecisionFloat.Find(VariableName))
+		auto& Variable = SharedVariables_CompressedDoublePrecisionFloat.Variables[Slot];
+		Variable.BindIndex = BindCompressedDoublePrecisionFloat(
+			Variable.CurrentValue,
+			Variable.PredictionRule,
+			Variable.CombineRule,
+			Variable.SimulationRule,
+			Variable.InterpolationRule
+		);
+
+		if (Variable.BindIndex < 0)
 		{
-			Variable->BindIndex = BindCompressedDoublePrecisionFloat(
-				Variable->CurrentValue,
-				Variable->PredictionRule,
-				Variable->CombineRule,
-				Variable->SimulationRule,
-				Variable->InterpolationRule
-			);
-
-			if (Variable->BindIndex < 0)
-			{
-				SharedVariables_CompressedDoublePrecisionFloat.Remove(VariableName);
-			}
+			LogFailedSharedVariableBind(EGMCE_SharedVariableType::CompressedDoublePrecisionFloat, Variable.VariableName);
+			SharedVariables_CompressedDoublePrecisionFloat.Retire(Slot);
 		}
 	}
 }
+
+bool UGMCE_CoreComponent::BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::CompressedDoublePrecisionFloat>& Variable)
+{
+	return BindTypedSharedVariable(Variable, [this](auto&&... Args) { return BindCompressedDoublePrecisionFloat(Forward<decltype(Args)>(Args)...); });
+}
 #pragma endregion
 
 // ---- Shared Variables: TruncatedDoublePrecisionFloat
@@ -810,14 +1823,20 @@ void UGMCE_CoreComponent::MakeSharedTruncatedDoublePrecisionFloat(const FName& V
                                    EGMC_SimulationMode SimulationRule,
                                    EGMC_InterpolationFunction InterpolationRule)
 {
-	if (!SharedVariables_TruncatedDoublePrecisionFloat.Contains(VariableName))
+	if (!CanMakeSharedVariable(VariableName)) return;
+
+	if (SharedVariables_TruncatedDoublePrecisionFloat.FindSlot(VariableName) == INDEX_NONE)
+	{
+		auto& Variable = SharedVariables_TruncatedDoublePrecisionFloat.Add(VariableName, DefaultValue);
+		Variable.PredictionRule = PredictionRule;
+		Variable.CombineRule = CombineRule;
+		Variable.SimulationRule = SimulationRule;
+		Variable.InterpolationRule = InterpolationRule;
+	}
+	else
 	{
-		SharedVariables_TruncatedDoublePrecisionFloat.Add(VariableName, TGMCE_SharedVariable<double>(VariableName, DefaultValue));
-		const auto Variable = SharedVariables_TruncatedDoublePrecisionFloat.Find(VariableName);
-		Variable->PredictionRule = PredictionRule;
-		Variable->CombineRule = CombineRule;
-		Variable->SimulationRule = SimulationRule;
-		Variable->InterpolationRule = InterpolationRule;
+		WarnIfSharedVariableRedefined(EGMCE_SharedVariableType::TruncatedDoublePrecisionFloat, *SharedVariables_TruncatedDoublePrecisionFloat.Find(VariableName), DefaultValue,
+			PredictionRule, CombineRule, SimulationRule, InterpolationRule);
 	}
 }
 
@@ -828,8 +1847,6 @@ void UGMCE_CoreComponent::GetSharedTruncatedDoublePrecisionFloat(const FName& Va
 
 bool UGMCE_CoreComponent::GetSharedTruncatedDoublePrecisionFloat(const FName& VariableName, double& OutValue)
 {
-	if (!SharedVariables_TruncatedDoublePrecisionFloat.Contains(VariableName)) return false;
-
 	if (const auto Variable = SharedVariables_TruncatedDoublePrecisionFloat.Find(VariableName))
 	{
 		OutValue = Variable->CurrentValue;
@@ -839,6 +1856,14 @@ bool UGMCE_CoreComponent::GetSharedTruncatedDoublePrecisionFloat(const FName& Va
 	return false;
 }
 
+bool UGMCE_CoreComponent::GetSharedTruncatedDoublePrecisionFloat(const FGMCE_SharedVariableHandle& Handle, double& OutValue) const
+{
+	if (Handle.Type != EGMCE_SharedVariableType::TruncatedDoublePrecisionFloat || !SharedVariables_TruncatedDoublePrecisionFloat.IsValidSlot(Handle.Slot)) return false;
+
+	OutValue = SharedVariables_TruncatedDoublePrecisionFloat.Variables[Handle.Slot].CurrentValue;
+	return true;
+}
+
 void UGMCE_CoreComponent::SetSharedTruncatedDoublePrecisionFloat(const FName& VariableName, double NewValue, bool& bOutSuccess)
 {
 	bOutSuccess = SetSharedTruncatedDoublePrecisionFloat(VariableName, NewValue);
@@ -846,42 +1871,46 @@ void UGMCE_CoreComponent::SetSharedTruncatedDoublePrecisionFloat(const FName& Va
 
 bool UGMCE_CoreComponent::SetSharedTruncatedDoublePrecisionFloat(const FName& VariableName, double NewValue)
 {
-	if (!SharedVariables_TruncatedDoublePrecisionFloat.Contains(VariableName)) return false;
+	const int32 Slot = SharedVariables_TruncatedDoublePrecisionFloat.FindSlot(VariableName);
+	if (Slot == INDEX_NONE) return false;
 
-	if (const auto Variable = SharedVariables_TruncatedDoublePrecisionFloat.Find(VariableName))
-	{
-		Variable->CurrentValue = NewValue;
-		return true;
-	}
+	SharedVariables_TruncatedDoublePrecisionFloat.SetValue(Slot, NewValue);
+	return true;
+}
 
-	return false;
+bool UGMCE_CoreComponent::SetSharedTruncatedDoublePrecisionFloat(const FGMCE_SharedVariableHandle& Handle, double NewValue)
+{
+	if (Handle.Type != EGMCE_SharedVariableType::TruncatedDoublePrecisionFloat || !SharedVariables_TruncatedDoublePrecisionFloat.IsValidSlot(Handle.Slot)) return false;
+
+	SharedVariables_TruncatedDoublePrecisionFloat.SetValue(Handle.Slot, NewValue);
+	return true;
 }
 
 void UGMCE_CoreComponent::BindSharedTruncatedDoublePrecisionFloatVariables()
 {
-	TArray<FName> Names;
-	SharedVariables_TruncatedDoublePrecisionFloat.GenerateKeyArray(Names);
-	Names.Sort([](const FName& A, const FName& B){ return A.FastLess(B); });
-
-	for (FName& VariableName : Names)
+	for (const int32 Slot : SharedVariables_TruncatedDoublePrecisionFloat.GetBindOrder())
 	{
-		if (const auto Variable = SharedVariables_TruncatedDoublePrecisionFloat.Find(VariableName))
+		auto& Variable = SharedVariables_TruncatedDoublePrecisionFloat.Variables[Slot];
+		Variable.BindIndex = BindTruncatedDoublePrecisionFloat(
+			Variable.CurrentValue,
+			Variable.PredictionRule,
+			Variable.CombineRule,
+			Variable.SimulationRule,
+			Variable.InterpolationRule
+		);
+
+		if (Variable.BindIndex < 0)
 		{
-			Variable->BindIndex = BindTruncatedDoublePrecisionFloat(
-				Variable->CurrentValue,
-				Variable->PredictionRule,
-				Variable->CombineRule,
-				Variable->SimulationRule,
-				Variable->InterpolationRule
-			);
-
-			if (Variable->BindIndex < 0)
-			{
-				SharedVariables_TruncatedDoublePrecisionFloat.Remove(VariableName);
-			}
+			LogFailedSharedVariableBind(EGMCE_SharedVariableType::TruncatedDoublePrecisionFloat, Variable.VariableName);
+			SharedVariables_TruncatedDoublePrecisionFloat.Retire(Slot);
 		}
 	}
 }
+
+bool UGMCE_CoreComponent::BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::TruncatedDoublePrecisionFloat>& Variable)
+{
+	return BindTypedSharedVariable(Variable, [this](auto&&... Args) { return BindTruncatedDoublePrecisionFloat(Forward<decltype(Args)>(Args)...); });
+}
 #pragma endregion
 
 // ---- Shared Variables: CompressedVector2D
@@ -891,14 +1920,20 @@ void UGMCE_CoreComponent::MakeSharedCompressedVector2D(const FName& VariableName
                                    EGMC_SimulationMode SimulationRule,
                                    EGMC_InterpolationFunction InterpolationRule)
 {
-	if (!SharedVariables_CompressedVector2D.Contains(VariableName))
+	if (!CanMakeSharedVariable(VariableName)) return;
+
+	if (SharedVariables_CompressedVector2D.FindSlot(VariableName) == INDEX_NONE)
+	{
+		auto& Variable = SharedVariables_CompressedVector2D.Add(VariableName, DefaultValue);
+		Variable.PredictionRule = PredictionRule;
+		Variable.CombineRule = CombineRule;
+		Variable.SimulationRule = SimulationRule;
+		Variable.InterpolationRule = InterpolationRule;
+	}
+	else
 	{
-		SharedVariables_CompressedVector2D.Add(VariableName, TGMCE_SharedVariable<FVector2D>(VariableName, DefaultValue));
-		const auto Variable = SharedVariables_CompressedVector2D.Find(VariableName);
-		Variable->PredictionRule = PredictionRule;
-		Variable->CombineRule = CombineRule;
-		Variable->SimulationRule = SimulationRule;
-		Variable->InterpolationRule = InterpolationRule;
+		WarnIfSharedVariableRedefined(EGMCE_SharedVariableType::CompressedVector2D, *SharedVariables_CompressedVector2D.Find(VariableName), DefaultValue,
+			PredictionRule, CombineRule, SimulationRule, InterpolationRule);
 	}
 }
 
@@ -909,8 +1944,6 @@ void UGMCE_CoreComponent::GetSharedCompressedVector2D(const FName& VariableName,
 
 bool UGMCE_CoreComponent::GetSharedCompressedVector2D(const FName& VariableName, FVector2D& OutValue)
 {
-	if (!SharedVariables_CompressedVector2D.Contains(VariableName)) return false;
-
 	if (const auto Variable = SharedVariables_CompressedVector2D.Find(VariableName))
 	{
 		OutValue = Variable->CurrentValue;
@@ -920,6 +1953,14 @@ bool UGMCE_CoreComponent::GetSharedCompressedVector2D(const FName& VariableName,
 	return false;
 }
 
+bool UGMCE_CoreComponent::GetSharedCompressedVector2D(const FGMCE_SharedVariableHandle& Handle, FVector2D& OutValue) const
+{
+	if (Handle.Type != EGMCE_SharedVariableType::CompressedVector2D || !SharedVariables_CompressedVector2D.IsValidSlot(Handle.Slot)) return false;
+
+	OutValue = SharedVariables_CompressedVector2D.Variables[Handle.Slot].CurrentValue;
+	return true;
+}
+
 void UGMCE_CoreComponent::SetSharedCompressedVector2D(const FName& VariableName, FVector2D NewValue, bool& bOutSuccess)
 {
 	bOutSuccess = SetSharedCompressedVector2D(VariableName, NewValue);
@@ -927,42 +1968,46 @@ void UGMCE_CoreComponent::SetSharedCompressedVector2D(const FName& VariableName,
 
 bool UGMCE_CoreComponent::SetSharedCompressedVector2D(const FName& VariableName, FVector2D NewValue)
 {
-	if (!SharedVariables_CompressedVector2D.Contains(VariableName)) return false;
+	const int32 Slot = SharedVariables_CompressedVector2D.FindSlot(VariableName);
+	if (Slot == INDEX_NONE) return false;
 
-	if (const auto Variable = SharedVariables_CompressedVector2D.Find(VariableName))
-	{
-		Variable->CurrentValue = NewValue;
-		return true;
-	}
+	SharedVariables_CompressedVector2D.SetValue(Slot, NewValue);
+	return true;
+}
 
-	return false;
+bool UGMCE_CoreComponent::SetSharedCompressedVector2D(const FGMCE_SharedVariableHandle& Handle, FVector2D NewValue)
+{
+	if (Handle.Type != EGMCE_SharedVariableType::CompressedVector2D || !SharedVariables_CompressedVector2D.IsValidSlot(Handle.Slot)) return false;
+
+	SharedVariables_CompressedVector2D.SetValue(Handle.Slot, NewValue);
+	return true;
 }
 
 void UGMCE_CoreComponent::BindSharedCompressedVector2DVariables()
 {
-	TArray<FName> Names;
-	SharedVariables_CompressedVector2D.GenerateKeyArray(Names);
-	Names.Sort([](const FName& A, const FName& B){ return A.FastLess(B); });
-
-	for (FName& VariableName : Names)
+	for (const int32 Slot : SharedVariables_CompressedVector2D.GetBindOrder())
 	{
-		if (const auto Variable = SharedVariables_CompressedVector2D.Find(VariableName))
+		auto& Variable = SharedVariables_CompressedVector2D.Variables[Slot];
+		Variable.BindIndex = BindCompressedVector2D(
+			Variable.CurrentValue,
+			Variable.PredictionRule,
+			Variable.CombineRule,
+			Variable.SimulationRule,
+			Variable.InterpolationRule
+		);
+
+		if (Variable.BindIndex < 0)
 		{
-			Variable->BindIndex = BindCompressedVector2D(
-				Variable->CurrentValue,
-				Variable->PredictionRule,
-				Variable->CombineRule,
-				Variable->SimulationRule,
-				Variable->InterpolationRule
-			);
-
-			if (Variable->BindIndex < 0)
-			{
-				SharedVariables_CompressedVector2D.Remove(VariableName);
-			}
+			LogFailedSharedVariableBind(EGMCE_SharedVariableType::CompressedVector2D, Variable.VariableName);
+			SharedVariables_CompressedVector2D.Retire(Slot);
 		}
 	}
 }
+
+bool UGMCE_CoreComponent::BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::CompressedVector2D>& Variable)
+{
+	return BindTypedSharedVariable(Variable, [this](auto&&... Args) { return BindCompressedVector2D(Forward<decltype(Args)>(Args)...); });
+}
 #pragma endregion
 
 // ---- Shared Variables: CompressedVector
@@ -972,14 +2017,20 @@ void UGMCE_CoreComponent::MakeSharedCompressedVector(const FName& VariableName,
                                    EGMC_SimulationMode SimulationRule,
                                    EGMC_InterpolationFunction InterpolationRule)
 {
-	if (!SharedVariables_CompressedVector.Contains(VariableName))
+	if (!CanMakeSharedVariable(VariableName)) return;
+
+	if (SharedVariables_CompressedVector.FindSlot(VariableName) == INDEX_NONE)
+	{
+		auto& Variable = SharedVariables_CompressedVector.Add(VariableName, DefaultValue);
+		Variable.PredictionRule = PredictionRule;
+		Variable.CombineRule = CombineRule;
+		Variable.SimulationRule = SimulationRule;
+		Variable.InterpolationRule = InterpolationRule;
+	}
+	else
 	{
-		SharedVariables_CompressedVector.Add(VariableName, TGMCE_SharedVariable<FVector>(VariableName, DefaultValue));
-		const auto Variable = SharedVariables_CompressedVector.Find(VariableName);
-		Variable->PredictionRule = PredictionRule;
-		Variable->CombineRule = CombineRule;
-		Variable->SimulationRule = SimulationRule;
-		Variable->InterpolationRule = InterpolationRule;
+		WarnIfSharedVariableRedefined(EGMCE_SharedVariableType::CompressedVector, *SharedVariables_CompressedVector.Find(VariableName), DefaultValue,
+			PredictionRule, CombineRule, SimulationRule, InterpolationRule);
 	}
 }
 
@@ -990,8 +2041,6 @@ void UGMCE_CoreComponent::GetSharedCompressedVector(const FName& VariableName, F
 
 bool UGMCE_CoreComponent::GetSharedCompressedVector(const FName& VariableName, FVector& OutValue)
 {
-	if (!SharedVariables_CompressedVector.Contains(VariableName)) return false;
-
 	if (const auto Variable = SharedVariables_CompressedVector.Find(VariableName))
 	{
 		OutValue = Variable->CurrentValue;
@@ -1001,6 +2050,14 @@ bool UGMCE_CoreComponent::GetSharedCompressedVector(const FName& VariableName, F
 	return false;
 }
 
+bool UGMCE_CoreComponent::GetSharedCompressedVector(const FGMCE_SharedVariableHandle& Handle, FVector& OutValue) const
+{
+	if (Handle.Type != EGMCE_SharedVariableType::CompressedVector || !SharedVariables_CompressedVector.IsValidSlot(Handle.Slot)) return false;
+
+	OutValue = SharedVariables_CompressedVector.Variables[Handle.Slot].CurrentValue;
+	return true;
+}
+
 void UGMCE_CoreComponent::SetSharedCompressedVector(const FName& VariableName, FVector NewValue, bool& bOutSuccess)
 {
 	bOutSuccess = SetSharedCompressedVector(VariableName, NewValue);
@@ -1008,42 +2065,46 @@ void UGMCE_CoreComponent::SetSharedCompressedVector(const FName& VariableName, F
 
 bool UGMCE_CoreComponent::SetSharedCompressedVector(const FName& VariableName, FVector NewValue)
 {
-	if (!SharedVariables_CompressedVector.Contains(VariableName)) return false;
+	const int32 Slot = SharedVariables_CompressedVector.FindSlot(VariableName);
+	if (Slot == INDEX_NONE) return false;
 
-	if (const auto Variable = SharedVariables_CompressedVector.Find(VariableName))
-	{
-		Variable->CurrentValue = NewValue;
-		return true;
-	}
+	SharedVariables_CompressedVector.SetValue(Slot, NewValue);
+	return true;
+}
 
-	return false;
+bool UGMCE_CoreComponent::SetSharedCompressedVector(const FGMCE_SharedVariableHandle& Handle, FVector NewValue)
+{
+	if (Handle.Type != EGMCE_SharedVariableType::CompressedVector || !SharedVariables_CompressedVector.IsValidSlot(Handle.Slot)) return false;
+
+	SharedVariables_CompressedVector.SetValue(Handle.Slot, NewValue);
+	return true;
 }
 
 void UGMCE_CoreComponent::BindSharedCompressedVectorVariables()
 {
-	TArray<FName> Names;
-	SharedVariables_CompressedVector.GenerateKeyArray(Names);
-	Names.Sort([](const FName& A, const FName& B){ return A.FastLess(B); });
-
-	for (FName& VariableName : Names)
+	for (const int32 Slot : SharedVariables_CompressedVector.GetBindOrder())
 	{
-		if (const auto Variable = SharedVariables_CompressedVector.Find(VariableName))
+		auto& Variable = SharedVariables_CompressedVector.Variables[Slot];
+		Variable.BindIndex = BindCompressedVector(
+			Variable.CurrentValue,
+			Variable.PredictionRule,
+			Variable.CombineRule,
+			Variable.SimulationRule,
+			Variable.InterpolationRule
+		);
+
+		if (Variable.BindIndex < 0)
 		{
-			Variable->BindIndex = BindCompressedVector(
-				Variable->CurrentValue,
-				Variable->PredictionRule,
-				Variable->CombineRule,
-				Variable->SimulationRule,
-				Variable->InterpolationRule
-			);
-
-			if (Variable->BindIndex < 0)
-			{
-				SharedVariables_CompressedVector.Remove(VariableName);
-			}
+			LogFailedSharedVariableBind(EGMCE_SharedVariableType::CompressedVector, Variable.VariableName);
+			SharedVariables_CompressedVector.Retire(Slot);
 		}
 	}
 }
+
+bool UGMCE_CoreComponent::BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::CompressedVector>& Variable)
+{
+	return BindTypedSharedVariable(Variable, [this](auto&&... Args) { return BindCompressedVector(Forward<decltype(Args)>(Args)...); });
+}
 #pragma endregion
 
 // ---- Shared Variables: CompressedRotator
@@ -1053,14 +2114,20 @@ void UGMCE_CoreComponent::MakeSharedCompressedRotator(const FName& VariableName,
                                    EGMC_SimulationMode SimulationRule,
                                    EGMC_InterpolationFunction InterpolationRule)
 {
-	if (!SharedVariables_CompressedRotator.Contains(VariableName))
+	if (!CanMakeSharedVariable(VariableName)) return;
+
+	if (SharedVariables_CompressedRotator.FindSlot(VariableName) == INDEX_NONE)
 	{
-		SharedVariables_CompressedRotator.Add(VariableName, TGMCE_SharedVariable<FRotator>(VariableName, DefaultValue));
-		const auto Variable = SharedVariables_CompressedRotator.Find(VariableName);
-		Variable->PredictionRule = PredictionRule;
-		Variable->CombineRule = CombineRule;
-		Variable->SimulationRule = SimulationRule;
-		Variable->InterpolationRule = InterpolationRule;
+		auto& Variable = SharedVariables_CompressedRotator.Add(VariableName, DefaultValue);
+		Variable.PredictionRule = PredictionRule;
+		Variable.CombineRule = CombineRule;
+		Variable.SimulationRule = SimulationRule;
+		Variable.InterpolationRule = InterpolationRule;
+	}
+	else
+	{
+		WarnIfSharedVariableRedefined(EGMCE_SharedVariableType::CompressedRotator, *SharedVariables_CompressedRotator.Find(VariableName), DefaultValue,
+			PredictionRule, CombineRule, SimulationRule, InterpolationRule);
 	}
 }
 
@@ -1071,8 +2138,6 @@ void UGMCE_CoreComponent::GetSharedCompressedRotator(const FName& VariableName,
 
 bool UGMCE_CoreComponent::GetSharedCompressedRotator(const FName& VariableName, FRotator& OutValue)
 {
-	if (!SharedVariables_CompressedRotator.Contains(VariableName)) return false;
-
 	if (const auto Variable = SharedVariables_CompressedRotator.Find(VariableName))
 	{
 		OutValue = Variable->CurrentValue;
@@ -1082,6 +2147,14 @@ bool UGMCE_CoreComponent::GetSharedCompressedRotator(const FName& VariableName,
 	return false;
 }
 
+bool UGMCE_CoreComponent::GetSharedCompressedRotator(const FGMCE_SharedVariableHandle& Handle, FRotator& OutValue) const
+{
+	if (Handle.Type != EGMCE_SharedVariableType::CompressedRotator || !SharedVariables_CompressedRotator.IsValidSlot(Handle.Slot)) return false;
+
+	OutValue = SharedVariables_CompressedRotator.Variables[Handle.Slot].CurrentValue;
+	return true;
+}
+
 void UGMCE_CoreComponent::SetSharedCompressedRotator(const FName& VariableName, FRotator NewValue, bool& bOutSuccess)
 {
 	bOutSuccess = SetSharedCompressedRotator(VariableName, NewValue);
@@ -1089,42 +2162,46 @@ void UGMCE_CoreComponent::SetSharedCompressedRotator(const FName& VariableName,
 
 bool UGMCE_CoreComponent::SetSharedCompressedRotator(const FName& VariableName, FRotator NewValue)
 {
-	if (!SharedVariables_CompressedRotator.Contains(VariableName)) return false;
+	const int32 Slot = SharedVariables_CompressedRotator.FindSlot(VariableName);
+	if (Slot == INDEX_NONE) return false;
 
-	if (const auto Variable = SharedVariables_CompressedRotator.Find(VariableName))
-	{
-		Variable->CurrentValue = NewValue;
-		return true;
-	}
+	SharedVariables_CompressedRotator.SetValue(Slot, NewValue);
+	return true;
+}
 
-	return false;
+bool UGMCE_CoreComponent::SetSharedCompressedRotator(const FGMCE_SharedVariableHandle& Handle, FRotator NewValue)
+{
+	if (Handle.Type != EGMCE_SharedVariableType::CompressedRotator || !SharedVariables_CompressedRotator.IsValidSlot(Handle.Slot)) return false;
+
+	SharedVariables_CompressedRotator.SetValue(Handle.Slot, NewValue);
+	return true;
 }
 
 void UGMCE_CoreComponent::BindSharedCompressedRotatorVariables()
 {
-	TArray<FName> Names;
-	SharedVariables_CompressedRotator.GenerateKeyArray(Names);
-	Names.Sort([](const FName& A, const FName& B){ return A.FastLess(B); });
-
-	for (FName& VariableName : Names)
+	for (const int32 Slot : SharedVariables_CompressedRotator.GetBindOrder())
 	{
-		if (const auto Variable = SharedVariables_CompressedRotator.Find(VariableName))
+		auto& Variable = SharedVariables_CompressedRotator.Variables[Slot];
+		Variable.BindIndex = BindCompressedRotator(
+			Variable.CurrentValue,
+			Variable.PredictionRule,
+			Variable.CombineRule,
+			Variable.SimulationRule,
+			Variable.InterpolationRule
+		);
+
+		if (Variable.BindIndex < 0)
 		{
-			Variable->BindIndex = BindCompressedRotator(
-				Variable->CurrentValue,
-				Variable->PredictionRule,
-				Variable->CombineRule,
-				Variable->SimulationRule,
-				Variable->InterpolationRule
-			);
-
-			if (Variable->BindIndex < 0)
-			{
-				SharedVariables_CompressedRotator.Remove(VariableName);
-			}
+			LogFailedSharedVariableBind(EGMCE_SharedVariableType::CompressedRotator, Variable.VariableName);
+			SharedVariables_CompressedRotator.Retire(Slot);
 		}
 	}
 }
+
+bool UGMCE_CoreComponent::BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::CompressedRotator>& Variable)
+{
+	return BindTypedSharedVariable(Variable, [this](auto&&... Args) { return BindCompressedRotator(Forward<decltype(Args)>(Args)...); });
+}
 #pragma endregion
 
 // ---- Shared Variables: ActorReference
@@ -1134,14 +2211,20 @@ void UGMCE_CoreComponent::MakeSharedActorReference(const FName& VariableName, AA
                                    EGMC_SimulationMode SimulationRule,
                                    EGMC_InterpolationFunction InterpolationRule)
 {
-	if (!SharedVariables_ActorReference.Contains(VariableName))
+	if (!CanMakeSharedVariable(VariableName)) return;
+
+	if (SharedVariables_ActorReference.FindSlot(VariableName) == INDEX_NONE)
+	{
+		auto& Variable = SharedVariables_ActorReference.Add(VariableName, DefaultValue);
+		Variable.PredictionRule = PredictionRule;
+		Variable.CombineRule = CombineRule;
+		Variable.SimulationRule = SimulationRule;
+		Variable.InterpolationRule = InterpolationRule;
+	}
+	else
 	{
-		SharedVariables_ActorReference.Add(VariableName, TGMCE_SharedVariable<AActor*>(VariableName, DefaultValue));
-		const auto Variable = SharedVariables_ActorReference.Find(VariableName);
-		Variable->PredictionRule = PredictionRule;
-		Variable->CombineRule = CombineRule;
-		Variable->SimulationRule = SimulationRule;
-		Variable->InterpolationRule = InterpolationRule;
+		WarnIfSharedVariableRedefined(EGMCE_SharedVariableType::ActorReference, *SharedVariables_ActorReference.Find(VariableName), DefaultValue,
+			PredictionRule, CombineRule, SimulationRule, InterpolationRule);
 	}
 }
 
@@ -1152,8 +2235,6 @@ void UGMCE_CoreComponent::GetSharedActorReference(const FName& VariableName, AAc
 
 bool UGMCE_CoreComponent::GetSharedActorReference(const FName& VariableName, AActor*& OutValue)
 {
-	if (!SharedVariables_ActorReference.Contains(VariableName)) return false;
-
 	if (const auto Variable = SharedVariables_ActorReference.Find(VariableName))
 	{
 		OutValue = Variable->CurrentValue;
@@ -1163,6 +2244,14 @@ bool UGMCE_CoreComponent::GetSharedActorReference(const FName& VariableName, AAc
 	return false;
 }
 
+bool UGMCE_CoreComponent::GetSharedActorReference(const FGMCE_SharedVariableHandle& Handle, AActor*& OutValue) const
+{
+	if (Handle.Type != EGMCE_SharedVariableType::ActorReference || !SharedVariables_ActorReference.IsValidSlot(Handle.Slot)) return false;
+
+	OutValue = SharedVariables_ActorReference.Variables[Handle.Slot].CurrentValue;
+	return true;
+}
+
 void UGMCE_CoreComponent::SetSharedActorReference(const FName& VariableName, AActor* NewValue, bool& bOutSuccess)
 {
 	bOutSuccess = SetSharedActorReference(VariableName, NewValue);
@@ -1170,42 +2259,46 @@ void UGMCE_CoreComponent::SetSharedActorReference(const FName& VariableName, AAc
 
 bool UGMCE_CoreComponent::SetSharedActorReference(const FName& VariableName, AActor* NewValue)
 {
-	if (!SharedVariables_ActorReference.Contains(VariableName)) return false;
+	const int32 Slot = SharedVariables_ActorReference.FindSlot(VariableName);
+	if (Slot == INDEX_NONE) return false;
 
-	if (const auto Variable = SharedVariables_ActorReference.Find(VariableName))
-	{
-		Variable->CurrentValue = NewValue;
-		return true;
-	}
+	SharedVariables_ActorReference.SetValue(Slot, NewValue);
+	return true;
+}
 
-	return false;
+bool UGMCE_CoreComponent::SetSharedActorReference(const FGMCE_SharedVariableHandle& Handle, AActor* NewValue)
+{
+	if (Handle.Type != EGMCE_SharedVariableType::ActorReference || !SharedVariables_ActorReference.IsValidSlot(Handle.Slot)) return false;
+
+	SharedVariables_ActorReference.SetValue(Handle.Slot, NewValue);
+	return true;
 }
 
 void UGMCE_CoreComponent::BindSharedActorReferenceVariables()
 {
-	TArray<FName> Names;
-	SharedVariables_ActorReference.GenerateKeyArray(Names);
-	Names.Sort([](const FName& A, const FName& B){ return A.FastLess(B); });
-
-	for (FName& VariableName : Names)
+	for (const int32 Slot : SharedVariables_ActorReference.GetBindOrder())
 	{
-		if (const auto Variable = SharedVariables_ActorReference.Find(VariableName))
+		auto& Variable = SharedVariables_ActorReference.Variables[Slot];
+		Variable.BindIndex = BindActorReference(
+			Variable.CurrentValue,
+			Variable.PredictionRule,
+			Variable.CombineRule,
+			Variable.SimulationRule,
+			Variable.InterpolationRule
+		);
+
+		if (Variable.BindIndex < 0)
 		{
-			Variable->BindIndex = BindActorReference(
-				Variable->CurrentValue,
-				Variable->PredictionRule,
-				Variable->CombineRule,
-				Variable->SimulationRule,
-				Variable->InterpolationRule
-			);
-
-			if (Variable->BindIndex < 0)
-			{
-				SharedVariables_ActorReference.Remove(VariableName);
-			}
+			LogFailedSharedVariableBind(EGMCE_SharedVariableType::ActorReference, Variable.VariableName);
+			SharedVariables_ActorReference.Retire(Slot);
 		}
 	}
 }
+
+bool UGMCE_CoreComponent::BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::ActorReference>& Variable)
+{
+	return BindTypedSharedVariable(Variable, [this](auto&&... Args) { return BindActorReference(Forward<decltype(Args)>(Args)...); });
+}
 #pragma endregion
 
 // ---- Shared Variables: ActorComponentReference
@@ -1215,14 +2308,20 @@ void UGMCE_CoreComponent::MakeSharedActorComponentReference(const FName& Variabl
                                    EGMC_SimulationMode SimulationRule,
                                    EGMC_InterpolationFunction InterpolationRule)
 {
-	if (!SharedVariables_ActorComponentReference.Contains(VariableName))
+	if (!CanMakeSharedVariable(VariableName)) return;
+
+	if (SharedVariables_ActorComponentReference.FindSlot(VariableName) == INDEX_NONE)
+	{
+		auto& Variable = SharedVariables_ActorComponentReference.Add(VariableName, DefaultValue);
+		Variable.PredictionRule = PredictionRule;
+		Variable.CombineRule = CombineRule;
+		Variable.SimulationRule = SimulationRule;
+		Variable.InterpolationRule = InterpolationRule;
+	}
+	else
 	{
-		SharedVariables_ActorComponentReference.Add(VariableName, TGMCE_SharedVariable<UActorComponent*>(VariableName, DefaultValue));
-		const auto Variable = SharedVariables_ActorComponentReference.Find(VariableName);
-		Variable->PredictionRule = PredictionRule;
-		Variable->CombineRule = CombineRule;
-		Variable->SimulationRule = SimulationRule;
-		Variable->InterpolationRule = InterpolationRule;
+		WarnIfSharedVariableRedefined(EGMCE_SharedVariableType::ActorComponentReference, *SharedVariables_ActorComponentReference.Find(VariableName), DefaultValue,
+			PredictionRule, CombineRule, SimulationRule, InterpolationRule);
 	}
 }
 
@@ -1233,8 +2332,6 @@ void UGMCE_CoreComponent::GetSharedActorComponentReference(const FName& Variable
 
 bool UGMCE_CoreComponent::GetSharedActorComponentReference(const FName& VariableName, UActorComponent*& OutValue)
 {
-	if (!SharedVariables_ActorComponentReference.Contains(VariableName)) return false;
-
 	if (const auto Variable = SharedVariables_ActorComponentReference.Find(VariableName))
 	{
 		OutValue = Variable->CurrentValue;
@@ -1244,6 +2341,14 @@ bool UGMCE_CoreComponent::GetSharedActorComponentReference(const FName& Variable
 	return false;
 }
 
+bool UGMCE_CoreComponent::GetSharedActorComponentReference(const FGMCE_SharedVariableHandle& Handle, UActorComponent*& OutValue) const
+{
+	if (Handle.Type != EGMCE_SharedVariableType::ActorComponentReference || !SharedVariables_ActorComponentReference.IsValidSlot(Handle.Slot)) return false;
+
+	OutValue = SharedVariables_ActorComponentReference.Variables[Handle.Slot].CurrentValue;
+	return true;
+}
+
 void UGMCE_CoreComponent::SetSharedActorComponentReference(const FName& VariableName, UActorComponent* NewValue, bool& bOutSuccess)
 {
 	bOutSuccess = SetSharedActorComponentReference(VariableName, NewValue);
@@ -1251,42 +2356,46 @@ void UGMCE_CoreComponent::SetSharedActorComponentReference(const FName& Variable
 
 bool UGMCE_CoreComponent::SetSharedActorComponentReference(const FName& VariableName, UActorComponent* NewValue)
 {
-	if (!SharedVariables_ActorComponentReference.Contains(VariableName)) return false;
+	const int32 Slot = SharedVariables_ActorComponentReference.FindSlot(VariableName);
+	if (Slot == INDEX_NONE) return false;
 
-	if (const auto Variable = SharedVariables_ActorComponentReference.Find(VariableName))
-	{
-		Variable->CurrentValue = NewValue;
-		return true;
-	}
+	SharedVariables_ActorComponentReference.SetValue(Slot, NewValue);
+	return true;
+}
 
-	return false;
+bool UGMCE_CoreComponent::SetSharedActorComponentReference(const FGMCE_SharedVariableHandle& Handle, UActorComponent* NewValue)
+{
+	if (Handle.Type != EGMCE_SharedVariableType::ActorComponentReference || !SharedVariables_ActorComponentReference.IsValidSlot(Handle.Slot)) return false;
+
+	SharedVariables_ActorComponentReference.SetValue(Handle.Slot, NewValue);
+	return true;
 }
 
 void UGMCE_CoreComponent::BindSharedActorComponentReferenceVariables()
 {
-	TArray<FName> Names;
-	SharedVariables_ActorComponentReference.GenerateKeyArray(Names);
-	Names.Sort([](const FName& A, const FName& B){ return A.FastLess(B); });
-
-	for (FName& VariableName : Names)
+	for (const int32 Slot : SharedVariables_ActorComponentReference.GetBindOrder())
 	{
-		if (const auto Variable = SharedVariables_ActorComponentReference.Find(VariableName))
+		auto& Variable = SharedVariables_ActorComponentReference.Variables[Slot];
+		Variable.BindIndex = BindActorComponentReference(
+			Variable.CurrentValue,
+			Variable.PredictionRule,
+			Variable.CombineRule,
+			Variable.SimulationRule,
+			Variable.InterpolationRule
+		);
+
+		if (Variable.BindIndex < 0)
 		{
-			Variable->BindIndex = BindActorComponentReference(
-				Variable->CurrentValue,
-				Variable->PredictionRule,
-				Variable->CombineRule,
-				Variable->SimulationRule,
-				Variable->InterpolationRule
-			);
-
-			if (Variable->BindIndex < 0)
-			{
-				SharedVariables_ActorComponentReference.Remove(VariableName);
-			}
+			LogFailedSharedVariableBind(EGMCE_SharedVariableType::ActorComponentReference, Variable.VariableName);
+			SharedVariables_ActorComponentReference.Retire(Slot);
 		}
 	}
 }
+
+bool UGMCE_CoreComponent::BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::ActorComponentReference>& Variable)
+{
+	return BindTypedSharedVariable(Variable, [this](auto&&... Args) { return BindActorComponentReference(Forward<decltype(Args)>(Args)...); });
+}
 #pragma endregion
 
 // ---- Shared Variables: AnimMontageReference
@@ -1296,14 +2405,20 @@ void UGMCE_CoreComponent::MakeSharedAnimMontageReference(const FName& VariableNa
                                    EGMC_SimulationMode SimulationRule,
                                    EGMC_InterpolationFunction InterpolationRule)
 {
-	if (!SharedVariables_AnimMontageReference.Contains(VariableName))
+	if (!CanMakeSharedVariable(VariableName)) return;
+
+	if (SharedVariables_AnimMontageReference.FindSlot(VariableName) == INDEX_NONE)
+	{
+		auto& Variable = SharedVariables_AnimMontageReference.Add(VariableName, DefaultValue);
+		Variable.PredictionRule = PredictionRule;
+		Variable.CombineRule = CombineRule;
+		Variable.SimulationRule = SimulationRule;
+		Variable.InterpolationRule = InterpolationRule;
+	}
+	else
 	{
-		SharedVariables_AnimMontageReference.Add(VariableName, TGMCE_SharedVariable<UAnimMontage*>(VariableName, DefaultValue));
-		const auto Variable = SharedVariables_AnimMontageReference.Find(VariableName);
-		Variable->PredictionRule = PredictionRule;
-		Variable->CombineRule = CombineRule;
-		Variable->SimulationRule = SimulationRule;
-		Variable->InterpolationRule = InterpolationRule;
+		WarnIfSharedVariableRedefined(EGMCE_SharedVariableType::AnimMontageReference, *SharedVariables_AnimMontageReference.Find(VariableName), DefaultValue,
+			PredictionRule, CombineRule, SimulationRule, InterpolationRule);
 	}
 }
 
@@ -1314,8 +2429,6 @@ void UGMCE_CoreComponent::GetSharedAnimMontageReference(const FName& VariableNam
 
 bool UGMCE_CoreComponent::GetSharedAnimMontageReference(const FName& VariableName, UAnimMontage*& OutValue)
 {
-	if (!SharedVariables_AnimMontageReference.Contains(VariableName)) return false;
-
 	if (const auto Variable = SharedVariables_AnimMontageReference.Find(VariableName))
 	{
 		OutValue = Variable->CurrentValue;
@@ -1325,6 +2438,14 @@ bool UGMCE_CoreComponent::GetSharedAnimMontageReference(const FName& VariableNam
 	return false;
 }
 
+bool UGMCE_CoreComponent::GetSharedAnimMontageReference(const FGMCE_SharedVariableHandle& Handle, UAnimMontage*& OutValue) const
+{
+	if (Handle.Type != EGMCE_SharedVariableType::AnimMontageReference || !SharedVariables_AnimMontageReference.IsValidSlot(Handle.Slot)) return false;
+
+	OutValue = SharedVariables_AnimMontageReference.Variables[Handle.Slot].CurrentValue;
+	return true;
+}
+
 void UGMCE_CoreComponent::SetSharedAnimMontageReference(const FName& VariableName, UAnimMontage* NewValue, bool& bOutSuccess)
 {
 	bOutSuccess = SetSharedAnimMontageReference(VariableName, NewValue);
@@ -1332,42 +2453,46 @@ void UGMCE_CoreComponent::SetSharedAnimMontageReference(const FName& VariableNam
 
 bool UGMCE_CoreComponent::SetSharedAnimMontageReference(const FName& VariableName, UAnimMontage* NewValue)
 {
-	if (!SharedVariables_AnimMontageReference.Contains(VariableName)) return false;
+	const int32 Slot = SharedVariables_AnimMontageReference.FindSlot(VariableName);
+	if (Slot == INDEX_NONE) return false;
 
-	if (const auto Variable = SharedVariables_AnimMontageReference.Find(VariableName))
-	{
-		Variable->CurrentValue = NewValue;
-		return true;
-	}
+	SharedVariables_AnimMontageReference.SetValue(Slot, NewValue);
+	return true;
+}
 
-	return false;
+bool UGMCE_CoreComponent::SetSharedAnimMontageReference(const FGMCE_SharedVariableHandle& Handle, UAnimMontage* NewValue)
+{
+	if (Handle.Type != EGMCE_SharedVariableType::AnimMontageReference || !SharedVariables_AnimMontageReference.IsValidSlot(Handle.Slot)) return false;
+
+	SharedVariables_AnimMontageReference.SetValue(Handle.Slot, NewValue);
+	return true;
 }
 
 void UGMCE_CoreComponent::BindSharedAnimMontageReferenceVariables()
 {
-	TArray<FName> Names;
-	SharedVariables_AnimMontageReference.GenerateKeyArray(Names);
-	Names.Sort([](const FName& A, const FName& B){ return A.FastLess(B); });
-
-	for (FName& VariableName : Names)
+	for (const int32 Slot : SharedVariables_AnimMontageReference.GetBindOrder())
 	{
-		if (const auto Variable = SharedVariables_AnimMontageReference.Find(VariableName))
+		auto& Variable = SharedVariables_AnimMontageReference.Variables[Slot];
+		Variable.BindIndex = BindAnimMontageReference(
+			Variable.CurrentValue,
+			Variable.PredictionRule,
+			Variable.CombineRule,
+			Variable.SimulationRule,
+			Variable.InterpolationRule
+		);
+
+		if (Variable.BindIndex < 0)
 		{
-			Variable->BindIndex = BindAnimMontageReference(
-				Variable->CurrentValue,
-				Variable->PredictionRule,
-				Variable->CombineRule,
-				Variable->SimulationRule,
-				Variable->InterpolationRule
-			);
-
-			if (Variable->BindIndex < 0)
-			{
-				SharedVariables_AnimMontageReference.Remove(VariableName);
-			}
+			LogFailedSharedVariableBind(EGMCE_SharedVariableType::AnimMontageReference, Variable.VariableName);
+			SharedVariables_AnimMontageReference.Retire(Slot);
 		}
 	}
 }
+
+bool UGMCE_CoreComponent::BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::AnimMontageReference>& Variable)
+{
+	return BindTypedSharedVariable(Variable, [this](auto&&... Args) { return BindAnimMontageReference(Forward<decltype(Args)>(Args)...); });
+}
 #pragma endregion
 
 // ---- Shared Variables: Name
@@ -1377,14 +2502,20 @@ void UGMCE_CoreComponent::MakeSharedName(const FName& VariableName, FName Defaul
                                    EGMC_SimulationMode SimulationRule,
                                    EGMC_InterpolationFunction InterpolationRule)
 {
-	if (!SharedVariables_Name.Contains(VariableName))
+	if (!CanMakeSharedVariable(VariableName)) return;
+
+	if (SharedVariables_Name.FindSlot(VariableName) == INDEX_NONE)
 	{
-		SharedVariables_Name.Add(VariableName, TGMCE_SharedVariable<FName>(VariableName, DefaultValue));
-		const auto Variable = SharedVariables_Name.Find(VariableName);
-		Variable->PredictionRule = PredictionRule;
-		Variable->CombineRule = CombineRule;
-		Variable->SimulationRule = SimulationRule;
-		Variable->InterpolationRule = InterpolationRule;
+		auto& Variable = SharedVariables_Name.Add(VariableName, DefaultValue);
+		Variable.PredictionRule = PredictionRule;
+		Variable.CombineRule = CombineRule;
+		Variable.SimulationRule = SimulationRule;
+		Variable.InterpolationRule = InterpolationRule;
+	}
+	else
+	{
+		WarnIfSharedVariableRedefined(EGMCE_SharedVariableType::Name, *SharedVariables_Name.Find(VariableName), DefaultValue,
+			PredictionRule, CombineRule, SimulationRule, InterpolationRule);
 	}
 }
 
@@ -1395,8 +2526,6 @@ void UGMCE_CoreComponent::GetSharedName(const FName& VariableName, FName& OutVal
 
 bool UGMCE_CoreComponent::GetSharedName(const FName& VariableName, FName& OutValue)
 {
-	if (!SharedVariables_Name.Contains(VariableName)) return false;
-
 	if (const auto Variable = SharedVariables_Name.Find(VariableName))
 	{
 		OutValue = Variable->CurrentValue;
@@ -1406,6 +2535,14 @@ bool UGMCE_CoreComponent::GetSharedName(const FName& VariableName, FName& OutVal
 	return false;
 }
 
+bool UGMCE_CoreComponent::GetSharedName(const FGMCE_SharedVariableHandle& Handle, FName& OutValue) const
+{
+	if (Handle.Type != EGMCE_SharedVariableType::Name || !SharedVariables_Name.IsValidSlot(Handle.Slot)) return false;
+
+	OutValue = SharedVariables_Name.Variables[Handle.Slot].CurrentValue;
+	return true;
+}
+
 void UGMCE_CoreComponent::SetSharedName(const FName& VariableName, FName NewValue, bool& bOutSuccess)
 {
 	bOutSuccess = SetSharedName(VariableName, NewValue);
@@ -1413,42 +2550,46 @@ void UGMCE_CoreComponent::SetSharedName(const FName& VariableName, FName NewValu
 
 bool UGMCE_CoreComponent::SetSharedName(const FName& VariableName, FName NewValue)
 {
-	if (!SharedVariables_Name.Contains(VariableName)) return false;
+	const int32 Slot = SharedVariables_Name.FindSlot(VariableName);
+	if (Slot == INDEX_NONE) return false;
 
-	if (const auto Variable = SharedVariables_Name.Find(VariableName))
-	{
-		Variable->CurrentValue = NewValue;
-		return true;
-	}
+	SharedVariables_Name.SetValue(Slot, NewValue);
+	return true;
+}
 
-	return false;
+bool UGMCE_CoreComponent::SetSharedName(const FGMCE_SharedVariableHandle& Handle, FName NewValue)
+{
+	if (Handle.Type != EGMCE_SharedVariableType::Name || !SharedVariables_Name.IsValidSlot(Handle.Slot)) return false;
+
+	SharedVariables_Name.SetValue(Handle.Slot, NewValue);
+	return true;
 }
 
 void UGMCE_CoreComponent::BindSharedNameVariables()
 {
-	TArray<FName> Names;
-	SharedVariables_Name.GenerateKeyArray(Names);
-	Names.Sort([](const FName& A, const FName& B){ return A.FastLess(B); });
-
-	for (FName& VariableName : Names)
+	for (const int32 Slot : SharedVariables_Name.GetBindOrder())
 	{
-		if (const auto Variable = SharedVariables_Name.Find(VariableName))
+		auto& Variable = SharedVariables_Name.Variables[Slot];
+		Variable.BindIndex = BindName(
+			Variable.CurrentValue,
+			Variable.PredictionRule,
+			Variable.CombineRule,
+			Variable.SimulationRule,
+			Variable.InterpolationRule
+		);
+
+		if (Variable.BindIndex < 0)
 		{
-			Variable->BindIndex = BindName(
-				Variable->CurrentValue,
-				Variable->PredictionRule,
-				Variable->CombineRule,
-				Variable->SimulationRule,
-				Variable->InterpolationRule
-			);
-
-			if (Variable->BindIndex < 0)
-			{
-				SharedVariables_Name.Remove(VariableName);
-			}
+			LogFailedSharedVariableBind(EGMCE_SharedVariableType::Name, Variable.VariableName);
+			SharedVariables_Name.Retire(Slot);
 		}
 	}
 }
+
+bool UGMCE_CoreComponent::BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::Name>& Variable)
+{
+	return BindTypedSharedVariable(Variable, [this](auto&&... Args) { return BindName(Forward<decltype(Args)>(Args)...); });
+}
 #pragma endregion
 
 // ---- Shared Variables: GameplayTag
@@ -1458,14 +2599,20 @@ void UGMCE_CoreComponent::MakeSharedGameplayTag(const FName& VariableName, FGame
                                    EGMC_SimulationMode SimulationRule,
                                    EGMC_InterpolationFunction InterpolationRule)
 {
-	if (!SharedVariables_GameplayTag.Contains(VariableName))
+	if (!CanMakeSharedVariable(VariableName)) return;
+
+	if (SharedVariables_GameplayTag.FindSlot(VariableName) == INDEX_NONE)
+	{
+		auto& Variable = SharedVariables_GameplayTag.Add(VariableName, DefaultValue);
+		Variable.PredictionRule = PredictionRule;
+		Variable.CombineRule = CombineRule;
+		Variable.SimulationRule = SimulationRule;
+		Variable.InterpolationRule = InterpolationRule;
+	}
+	else
 	{
-		SharedVariables_GameplayTag.Add(VariableName, TGMCE_SharedVariable<FGameplayTag>(VariableName, DefaultValue));
-		const auto Variable = SharedVariables_GameplayTag.Find(VariableName);
-		Variable->PredictionRule = PredictionRule;
-		Variable->CombineRule = CombineRule;
-		Variable->SimulationRule = SimulationRule;
-		Variable->InterpolationRule = InterpolationRule;
+		WarnIfSharedVariableRedefined(EGMCE_SharedVariableType::GameplayTag, *SharedVariables_GameplayTag.Find(VariableName), DefaultValue,
+			PredictionRule, CombineRule, SimulationRule, InterpolationRule);
 	}
 }
 
@@ -1476,8 +2623,6 @@ void UGMCE_CoreComponent::GetSharedGameplayTag(const FName& VariableName, FGamep
 
 bool UGMCE_CoreComponent::GetSharedGameplayTag(const FName& VariableName, FGameplayTag& OutValue)
 {
-	if (!SharedVariables_GameplayTag.Contains(VariableName)) return false;
-
 	if (const auto Variable = SharedVariables_GameplayTag.Find(VariableName))
 	{
 		OutValue = Variable->CurrentValue;
@@ -1487,6 +2632,14 @@ bool UGMCE_CoreComponent::GetSharedGameplayTag(const FName& VariableName, FGamep
 	return false;
 }
 
+bool UGMCE_CoreComponent::GetSharedGameplayTag(const FGMCE_SharedVariableHandle& Handle, FGameplayTag& OutValue) const
+{
+	if (Handle.Type != EGMCE_SharedVariableType::GameplayTag || !SharedVariables_GameplayTag.IsValidSlot(Handle.Slot)) return false;
+
+	OutValue = SharedVariables_GameplayTag.Variables[Handle.Slot].CurrentValue;
+	return true;
+}
+
 void UGMCE_CoreComponent::SetSharedGameplayTag(const FName& VariableName, FGameplayTag NewValue, bool& bOutSuccess)
 {
 	bOutSuccess = SetSharedGameplayTag(VariableName, NewValue);
@@ -1494,42 +2647,46 @@ void UGMCE_CoreComponent::SetSharedGameplayTag(const FName& VariableName, FGamep
 
 bool UGMCE_CoreComponent::SetSharedGameplayTag(const FName& VariableName, FGameplayTag NewValue)
 {
-	if (!SharedVariables_GameplayTag.Contains(VariableName)) return false;
+	const int32 Slot = SharedVariables_GameplayTag.FindSlot(VariableName);
+	if (Slot == INDEX_NONE) return false;
 
-	if (const auto Variable = SharedVariables_GameplayTag.Find(VariableName))
-	{
-		Variable->CurrentValue = NewValue;
-		return true;
-	}
+	SharedVariables_GameplayTag.SetValue(Slot, NewValue);
+	return true;
+}
 
-	return false;
+bool UGMCE_CoreComponent::SetSharedGameplayTag(const FGMCE_SharedVariableHandle& Handle, FGameplayTag NewValue)
+{
+	if (Handle.Type != EGMCE_SharedVariableType::GameplayTag || !SharedVariables_GameplayTag.IsValidSlot(Handle.Slot)) return false;
+
+	SharedVariables_GameplayTag.SetValue(Handle.Slot, NewValue);
+	return true;
 }
 
 void UGMCE_CoreComponent::BindSharedGameplayTagVariables()
 {
-	TArray<FName> Names;
-	SharedVariables_GameplayTag.GenerateKeyArray(Names);
-	Names.Sort([](const FName& A, const FName& B){ return A.FastLess(B); });
-
-	for (FName& VariableName : Names)
+	for (const int32 Slot : SharedVariables_GameplayTag.GetBindOrder())
 	{
-		if (const auto Variable = SharedVariables_GameplayTag.Find(VariableName))
+		auto& Variable = SharedVariables_GameplayTag.Variables[Slot];
+		Variable.BindIndex = BindGameplayTag(
+			Variable.CurrentValue,
+			Variable.PredictionRule,
+			Variable.CombineRule,
+			Variable.SimulationRule,
+			Variable.InterpolationRule
+		);
+
+		if (Variable.BindIndex < 0)
 		{
-			Variable->BindIndex = BindGameplayTag(
-				Variable->CurrentValue,
-				Variable->PredictionRule,
-				Variable->CombineRule,
-				Variable->SimulationRule,
-				Variable->InterpolationRule
-			);
-
-			if (Variable->BindIndex < 0)
-			{
-				SharedVariables_GameplayTag.Remove(VariableName);
-			}
+			LogFailedSharedVariableBind(EGMCE_SharedVariableType::GameplayTag, Variable.VariableName);
+			SharedVariables_GameplayTag.Retire(Slot);
 		}
 	}
 }
+
+bool UGMCE_CoreComponent::BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::GameplayTag>& Variable)
+{
+	return BindTypedSharedVariable(Variable, [this](auto&&... Args) { return BindGameplayTag(Forward<decltype(Args)>(Args)...); });
+}
 #pragma endregion
 
 // ---- Shared Variables: GameplayTagContainer
@@ -1539,14 +2696,20 @@ void UGMCE_CoreComponent::MakeSharedGameplayTagContainer(const FName& VariableNa
                                    EGMC_SimulationMode SimulationRule,
                                    EGMC_InterpolationFunction InterpolationRule)
 {
-	if (!SharedVariables_GameplayTagContainer.Contains(VariableName))
+	if (!CanMakeSharedVariable(VariableName)) return;
+
+	if (SharedVariables_GameplayTagContainer.FindSlot(VariableName) == INDEX_NONE)
+	{
+		auto& Variable = SharedVariables_GameplayTagContainer.Add(VariableName, DefaultValue);
+		Variable.PredictionRule = PredictionRule;
+		Variable.CombineRule = CombineRule;
+		Variable.SimulationRule = SimulationRule;
+		Variable.InterpolationRule = InterpolationRule;
+	}
+	else
 	{
-		SharedVariables_GameplayTagContainer.Add(VariableName, TGMCE_SharedVariable<FGameplayTagContainer>(VariableName, DefaultValue));
-		const auto Variable = SharedVariables_GameplayTagContainer.Find(VariableName);
-		Variable->PredictionRule = PredictionRule;
-		Variable->CombineRule = CombineRule;
-		Variable->SimulationRule = SimulationRule;
-		Variable->InterpolationRule = InterpolationRule;
+		WarnIfSharedVariableRedefined(EGMCE_SharedVariableType::GameplayTagContainer, *SharedVariables_GameplayTagContainer.Find(VariableName), DefaultValue,
+			PredictionRule, CombineRule, SimulationRule, InterpolationRule);
 	}
 }
 
@@ -1557,8 +2720,6 @@ void UGMCE_CoreComponent::GetSharedGameplayTagContainer(const FName& VariableNam
 
 bool UGMCE_CoreComponent::GetSharedGameplayTagContainer(const FName& VariableName, FGameplayTagContainer& OutValue)
 {
-	if (!SharedVariables_GameplayTagContainer.Contains(VariableName)) return false;
-
 	if (const auto Variable = SharedVariables_GameplayTagContainer.Find(VariableName))
 	{
 		OutValue = Variable->CurrentValue;
@@ -1568,6 +2729,14 @@ bool UGMCE_CoreComponent::GetSharedGameplayTagContainer(const FName& VariableNam
 	return false;
 }
 
+bool UGMCE_CoreComponent::GetSharedGameplayTagContainer(const FGMCE_SharedVariableHandle& Handle, FGameplayTagContainer& OutValue) const
+{
+	if (Handle.Type != EGMCE_SharedVariableType::GameplayTagContainer || !SharedVariables_GameplayTagContainer.IsValidSlot(Handle.Slot)) return false;
+
+	OutValue = SharedVariables_GameplayTagContainer.Variables[Handle.Slot].CurrentValue;
+	return true;
+}
+
 void UGMCE_CoreComponent::SetSharedGameplayTagContainer(const FName& VariableName, FGameplayTagContainer NewValue, bool& bOutSuccess)
 {
 	bOutSuccess = SetSharedGameplayTagContainer(VariableName, NewValue);
@@ -1575,41 +2744,141 @@ void UGMCE_CoreComponent::SetSharedGameplayTagContainer(const FName& VariableNam
 
 bool UGMCE_CoreComponent::SetSharedGameplayTagContainer(const FName& VariableName, FGameplayTagContainer NewValue)
 {
-	if (!SharedVariables_GameplayTagContainer.Contains(VariableName)) return false;
+	const int32 Slot = SharedVariables_GameplayTagContainer.FindSlot(VariableName);
+	if (Slot == INDEX_NONE) return false;
 
-	if (const auto Variable = SharedVariables_GameplayTagContainer.Find(VariableName))
+	SharedVariables_GameplayTagContainer.SetValue(Slot, NewValue);
+	return true;
+}
+
+bool UGMCE_CoreComponent::SetSharedGameplayTagContainer(const FGMCE_SharedVariableHandle& Handle, FGameplayTagContainer NewValue)
+{
+	if (Handle.Type != EGMCE_SharedVariableType::GameplayTagContainer || !SharedVariables_GameplayTagContainer.IsValidSlot(Handle.Slot)) return false;
+
+	SharedVariables_GameplayTagContainer.SetValue(Handle.Slot, NewValue);
+	return true;
+}
+
+void UGMCE_CoreComponent::BindSharedGameplayTagContainerVariables()
+{
+	for (const int32 Slot : SharedVariables_GameplayTagContainer.GetBindOrder())
+	{
+		auto& Variable = SharedVariables_GameplayTagContainer.Variables[Slot];
+		Variable.BindIndex = BindGameplayTagContainer(
+			Variable.CurrentValue,
+			Variable.PredictionRule,
+			Variable.CombineRule,
+			Variable.SimulationRule,
+			Variable.InterpolationRule
+		);
+
+		if (Variable.BindIndex < 0)
+		{
+			LogFailedSharedVariableBind(EGMCE_SharedVariableType::GameplayTagContainer, Variable.VariableName);
+			SharedVariables_GameplayTagContainer.Retire(Slot);
+		}
+	}
+}
+
+bool UGMCE_CoreComponent::BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::GameplayTagContainer>& Variable)
+{
+	return BindTypedSharedVariable(Variable, [this](auto&&... Args) { return BindGameplayTagContainer(Forward<decltype(Args)>(Args)...); });
+}
+#pragma endregion
+
+// ---- Shared Variables: InstancedStruct
+#pragma region
+void UGMCE_CoreComponent::MakeSharedInstancedStruct(const FName& VariableName, FInstancedStruct DefaultValue,
+                                   EGMC_PredictionMode PredictionRule, EGMC_CombineMode CombineRule,
+                                   EGMC_SimulationMode SimulationRule,
+                                   EGMC_InterpolationFunction InterpolationRule)
+{
+	if (!CanMakeSharedVariable(VariableName)) return;
+
+	if (SharedVariables_InstancedStruct.FindSlot(VariableName) == INDEX_NONE)
+	{
+		auto& Variable = SharedVariables_InstancedStruct.Add(VariableName, DefaultValue);
+		Variable.PredictionRule = PredictionRule;
+		Variable.CombineRule = CombineRule;
+		Variable.SimulationRule = SimulationRule;
+		Variable.InterpolationRule = InterpolationRule;
+	}
+	else
+	{
+		WarnIfSharedVariableRedefined(EGMCE_SharedVariableType::InstancedStruct, *SharedVariables_InstancedStruct.Find(VariableName), DefaultValue,
+			PredictionRule, CombineRule, SimulationRule, InterpolationRule);
+	}
+}
+
+void UGMCE_CoreComponent::GetSharedInstancedStruct(const FName& VariableName, FInstancedStruct& OutValue, bool& bOutSuccess)
+{
+	bOutSuccess = GetSharedInstancedStruct(VariableName, OutValue);
+}
+
+bool UGMCE_CoreComponent::GetSharedInstancedStruct(const FName& VariableName, FInstancedStruct& OutValue)
+{
+	if (const auto Variable = SharedVariables_InstancedStruct.Find(VariableName))
 	{
-		Variable->CurrentValue = NewValue;
+		OutValue = Variable->CurrentValue;
 		return true;
 	}
 
 	return false;
 }
 
-void UGMCE_CoreComponent::BindSharedGameplayTagContainerVariables()
+bool UGMCE_CoreComponent::GetSharedInstancedStruct(const FGMCE_SharedVariableHandle& Handle, FInstancedStruct& OutValue) const
+{
+	if (Handle.Type != EGMCE_SharedVariableType::InstancedStruct || !SharedVariables_InstancedStruct.IsValidSlot(Handle.Slot)) return false;
+
+	OutValue = SharedVariables_InstancedStruct.Variables[Handle.Slot].CurrentValue;
+	return true;
+}
+
+void UGMCE_CoreComponent::SetSharedInstancedStruct(const FName& VariableName, FInstancedStruct NewValue, bool& bOutSuccess)
+{
+	bOutSuccess = SetSharedInstancedStruct(VariableName, NewValue);
+}
+
+bool UGMCE_CoreComponent::SetSharedInstancedStruct(const FName& VariableName, FInstancedStruct NewValue)
+{
+	const int32 Slot = SharedVariables_InstancedStruct.FindSlot(VariableName);
+	if (Slot == INDEX_NONE) return false;
+
+	SharedVariables_InstancedStruct.SetValue(Slot, NewValue);
+	return true;
+}
+
+bool UGMCE_CoreComponent::SetSharedInstancedStruct(const FGMCE_SharedVariableHandle& Handle, FInstancedStruct NewValue)
 {
-	TArray<FName> Names;
-	SharedVariables_GameplayTagContainer.GenerateKeyArray(Names);
-	Names.Sort([](const FName& A, const FName& B){ return A.FastLess(B); });
+	if (Handle.Type != EGMCE_SharedVariableType::InstancedStruct || !SharedVariables_InstancedStruct.IsValidSlot(Handle.Slot)) return false;
+
+	SharedVariables_InstancedStruct.SetValue(Handle.Slot, NewValue);
+	return true;
+}
 
-	for (FName& VariableName : Names)
+void UGMCE_CoreComponent::BindSharedInstancedStructVariables()
+{
+	for (const int32 Slot : SharedVariables_InstancedStruct.GetBindOrder())
 	{
-		if (const auto Variable = SharedVariables_GameplayTagContainer.Find(VariableName))
+		auto& Variable = SharedVariables_InstancedStruct.Variables[Slot];
+		Variable.BindIndex = BindInstancedStruct(
+			Variable.CurrentValue,
+			Variable.PredictionRule,
+			Variable.CombineRule,
+			Variable.SimulationRule,
+			Variable.InterpolationRule
+		);
+
+		if (Variable.BindIndex < 0)
 		{
-			Variable->BindIndex = BindGameplayTagContainer(
-				Variable->CurrentValue,
-				Variable->PredictionRule,
-				Variable->CombineRule,
-				Variable->SimulationRule,
-				Variable->InterpolationRule
-			);
-
-			if (Variable->BindIndex < 0)
-			{
-				SharedVariables_GameplayTagContainer.Remove(VariableName);
-			}
+			LogFailedSharedVariableBind(EGMCE_SharedVariableType::InstancedStruct, Variable.VariableName);
+			SharedVariables_InstancedStruct.Retire(Slot);
 		}
 	}
 }
-#pragma endregion
 
+bool UGMCE_CoreComponent::BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::InstancedStruct>& Variable)
+{
+	return BindTypedSharedVariable(Variable, [this](auto&&... Args) { return BindInstancedStruct(Forward<decltype(Args)>(Args)...); });
+}
+#pragma endregion
@@ -4,6 +4,7 @@
 #include "GMCPawn.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Kismet/KismetSystemLibrary.h"
+#include "Support/GMCE_TrajectorySubsystem.h"
 #include "Support/GMCE_UtilityLibrary.h"
 #include "Replication/Compression.h"
 
@@ -25,6 +26,18 @@ void UGMCE_OrganicMovementCmp::BeginPlay()
 {
 	Super::BeginPlay();
 
+	if (bPredictTrajectoryInParallel || bTrajectorySignificanceEnabled)
+	{
+		if (UWorld* World = GetWorld())
+		{
+			TrajectorySubsystem = World->GetSubsystem<UGMCE_TrajectorySubsystem>();
+			if (TrajectorySubsystem.IsValid() && bPredictTrajectoryInParallel)
+			{
+				TrajectorySubsystem->RegisterComponent(this);
+			}
+		}
+	}
+
 	FString RoleString = GetNetRoleAsString(GetOwnerRole());
 	if (IsRemotelyControlledServerPawn())
 	{
@@ -63,6 +76,17 @@ void UGMCE_OrganicMovementCmp::BeginPlay()
 
 }
 
+void UGMCE_OrganicMovementCmp::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (TrajectorySubsystem.IsValid())
+	{
+		TrajectorySubsystem->UnregisterComponent(this);
+		TrajectorySubsystem.Reset();
+	}
+	
+	Super::EndPlay(EndPlayReason);
+}
+
 
 // Called every frame
 void UGMCE_OrganicMovementCmp::TickComponent(float DeltaTime, ELevelTick TickType,
@@ -1133,6 +1157,8 @@ bool UGMCE_OrganicMovementCmp::IsInputPresent(bool bAllowGrace) const
 
 void UGMCE_OrganicMovementCmp::UpdateAllPredictions(float DeltaTime)
 {
+	UpdateTrajectorySignificance();
+	
 	if (bTrajectoryEnabled)
 	{
 		// Track trajectory even when we're in custom movement modes.
@@ -1154,7 +1180,15 @@ void UGMCE_OrganicMovementCmp::UpdateAllPredictions(float DeltaTime)
 		if (bTrajectoryEnabled && bPrecalculateFutureTrajectory)
 		{
 			// Only predict trajectory when we're grounded or in airborne mode.
-			UpdateTrajectoryPrediction();
+			if (TrajectorySubsystem.IsValid() && CanPredictTrajectoryInParallel())
+			{
+				// The subsystem will run it alongside everyone else's at the end of the frame.
+				bTrajectoryPredictionQueued = true;
+			}
+			else
+			{
+				UpdateTrajectoryPrediction();
+			}
 		}
 	}
 }
@@ -1221,122 +1255,196 @@ bool UGMCE_OrganicMovementCmp::IsPivotPredicted(FVector& OutPivotPrediction) con
 }
 
 FVector UGMCE_OrganicMovementCmp::PredictGroundedStopLocation(const FVector& CurrentVelocity, float BrakingDeceleration,
-	float Friction, float DeltaTime)
+	float Friction, float /*DeltaTime*/)
 {
-	if (CurrentVelocity.IsZero())
-	{
-		return FVector::ZeroVector;
-	}
-	
-	FVector Result = FVector::ZeroVector;
-	
+	// Constant deceleration, so the stopping distance is just v^2 / 2a; there's nothing to step through, and the
+	// result doesn't depend on how the movement is sub-stepped.
 	const FVector GroundedVelocity = CurrentVelocity * FVector(1.f, 1.f, 0.f);
-	const FVector GroundedDirection = GroundedVelocity.GetSafeNormal();
-	
-	if (const float RealBrakingDeceleration = BrakingDeceleration * Friction; RealBrakingDeceleration > 0.f)
+	const float RealBrakingDeceleration = BrakingDeceleration * Friction;
+	if (GroundedVelocity.IsZero() || RealBrakingDeceleration <= 0.f)
 	{
-		Result = GroundedDirection * (GroundedVelocity.SizeSquared() / (2 * RealBrakingDeceleration));
+		return FVector::ZeroVector;
 	}
-	
-	return Result;
+
+	// v * |v| / 2a, without normalizing.
+	return GroundedVelocity * (GroundedVelocity.Size() / (2.f * RealBrakingDeceleration));
 }
 
 FVector UGMCE_OrganicMovementCmp::PredictGroundedPivotLocation(const FVector& CurrentAcceleration,
-	const FVector& CurrentVelocity, const FRotator& CurrentRotation, float Friction, float DeltaTime, float AngleThreshold)
+	const FVector& CurrentVelocity, const FRotator& /*CurrentRotation*/, float Friction, float /*DeltaTime*/, float AngleThreshold)
 {
-	FVector Result = FVector::ZeroVector;
-	const FVector EffectiveAcceleration = CurrentAcceleration;
-	
 	const FVector GroundedVelocity = CurrentVelocity * FVector(1.f, 1.f, 0.f);
-	const FVector LocalVelocity = UKismetMathLibrary::LessLess_VectorRotator(GroundedVelocity, CurrentRotation);
-	const FVector LocalAcceleration = UKismetMathLibrary::LessLess_VectorRotator(EffectiveAcceleration, CurrentRotation);
-
-	const FVector Acceleration2D = EffectiveAcceleration * FVector(1.f, 1.f, 0.f);
+	const FVector Acceleration2D = CurrentAcceleration * FVector(1.f, 1.f, 0.f);
 	FVector AccelerationDir2D;
 	float AccelerationSize2D;
 	Acceleration2D.ToDirectionAndLength(AccelerationDir2D, AccelerationSize2D);
 
+	// Only a pivot if we're accelerating against our velocity; the angle between them is then above 90 degrees.
 	const float VelocityAlongAcceleration = (GroundedVelocity | AccelerationDir2D);
-	const float DotProduct = UKismetMathLibrary::Dot_VectorVector(LocalVelocity, LocalAcceleration);
-	const float AngleOffset = FMath::Abs(UGMCE_UtilityLibrary::GetAngleDifferenceXY(CurrentVelocity, CurrentAcceleration));
-	
-	if (AngleOffset >= AngleThreshold && VelocityAlongAcceleration < 0.f)
+	if (VelocityAlongAcceleration >= 0.f)
 	{
-		const float SpeedAlongAcceleration = -VelocityAlongAcceleration;
-		const float Divisor = AccelerationSize2D + 2.f * SpeedAlongAcceleration * Friction;
-		const float TimeToDirectionChange = SpeedAlongAcceleration / Divisor;
+		return FVector::ZeroVector;
+	}
+
+	// Compare cosines rather than taking the angle between the two; the angle is at or above the threshold exactly
+	// when the cosine is at or below the threshold's.
+	const float GroundedSpeed = GroundedVelocity.Size();
+	if (VelocityAlongAcceleration > FMath::Cos(FMath::DegreesToRadians(AngleThreshold)) * GroundedSpeed)
+	{
+		return FVector::ZeroVector;
+	}
 
-		const FVector AccelerationForce = EffectiveAcceleration -
-			(GroundedVelocity - AccelerationDir2D * GroundedVelocity.Size2D()) * Friction;
+	// Split velocity into the speed being reversed and the velocity across the acceleration.
+	const double ReverseSpeed = -VelocityAlongAcceleration;
+	const FVector CrossVelocity = GroundedVelocity + AccelerationDir2D * ReverseSpeed;
+	const double CrossSpeed = CrossVelocity.Size();
+	const double Acceleration = AccelerationSize2D;
 
-		Result = GroundedVelocity * TimeToDirectionChange + 0.5f * AccelerationForce *
-			TimeToDirectionChange * TimeToDirectionChange;
+	if (Friction * (ReverseSpeed + CrossSpeed) < 1e-4 * Acceleration)
+	{
+		// Friction is negligible; plain constant acceleration.
+		const double Time = ReverseSpeed / Acceleration;
+		return CrossVelocity * Time - AccelerationDir2D * (ReverseSpeed * ReverseSpeed / (2.0 * Acceleration));
 	}
 
-	return Result;	
+	// Trajectory integration applies friction as a drag from our velocity toward the acceleration direction at our
+	// current speed. The cross velocity w then decays as e^(-Ft), and the reversed speed s falls at A + F(s + |v|).
+	// Taking |v| as s + w makes that linear, and the time s reaches zero is the root of a quadratic in e^(-Ft).
+	const double HalfAccelerationTime = Acceleration / (2.0 * Friction);
+	const double Initial = ReverseSpeed + HalfAccelerationTime + CrossSpeed;
+	const double Decay = (CrossSpeed + FMath::Sqrt(CrossSpeed * CrossSpeed + 4.0 * Initial * HalfAccelerationTime)) / (2.0 * Initial);
+	const double Time = -FMath::Loge(Decay) / Friction;
+
+	const double ReverseDistance = Initial * (1.0 - Decay * Decay) / (2.0 * Friction) - HalfAccelerationTime * Time -
+		CrossSpeed * (1.0 - Decay) / Friction;
+
+	return CrossVelocity * ((1.0 - Decay) / Friction) - AccelerationDir2D * ReverseDistance;
 }
 
 FGMCE_MovementSampleCollection UGMCE_OrganicMovementCmp::GetMovementHistory(bool bOmitLatest) const
 {
 	FGMCE_MovementSampleCollection Result;
+	GetMovementHistoryView().AppendTo(Result.Samples, bOmitLatest);
+	return Result;	
+}
+
+FGMCE_MovementSampleCollection UGMCE_OrganicMovementCmp::PredictMovementFuture(const FTransform& FromOrigin,
+	const FRotator& ControllerRotation, const FQuat& MeshOffset, bool bIncludeHistory)
+{
+	FGMCE_TrajectoryPredictionInput Input;
+	const bool bQueueGroundTraces = BeginTrajectoryPrediction(FromOrigin, ControllerRotation, MeshOffset, Input);
+
+	FGMCE_MovementSampleCollection Predictions;
+	RunTrajectoryPrediction(Input, bIncludeHistory, Predictions);
 
-	const int32 TrajectoryHistoryCount = MovementSamples.Num();
-	if (TrajectoryHistoryCount > 0)
+	if (bQueueGroundTraces)
 	{
-		Result.Samples.Reserve(TrajectoryHistoryCount);
+		QueueTrajectoryGroundTraces(TrajectoryPredictionBuffers);
+	}
+	
+	return Predictions;	
+}
 
-		int32 Counter = 0;
-		for (auto& Sample : MovementSamples)
-		{
-			Counter++;
-			if (!bOmitLatest || Counter != TrajectoryHistoryCount - 1)
-				Result.Samples.Emplace(Sample);
-		}
+bool UGMCE_OrganicMovementCmp::BeginTrajectoryPrediction(const FTransform& FromOrigin, const FRotator& ControllerRotation,
+	const FQuat& MeshOffset, FGMCE_TrajectoryPredictionInput& OutInput)
+{
+	GatherTrajectoryPredictionInput(FromOrigin, ControllerRotation, MeshOffset, OutInput);
+
+	const bool bQueueGroundTraces = OutInput.bAsyncCollisions && TrajectoryGroundTraceFrame != GFrameCounter;
+	if (bQueueGroundTraces)
+	{
+		CollectTrajectoryGroundTraces();
 	}
 
-	return Result;	
+	if (OutInput.NumSamples != TrajectoryGroundHitsNumSamples || OutInput.TimePerSample != TrajectoryGroundHitsTimePerSample)
+	{
+		// Hits are by sample index; under a different layout they'd be applied at the wrong times and places. The
+		// same goes for any probes still in flight.
+		TrajectoryGroundHits.Reset();
+		PendingTrajectoryGroundTraces.Reset();
+		TrajectoryGroundHitsNumSamples = OutInput.NumSamples;
+		TrajectoryGroundHitsTimePerSample = OutInput.TimePerSample;
+	}
+	OutInput.GroundHits = TrajectoryGroundHits;
+
+	return bQueueGroundTraces;
 }
 
-FGMCE_MovementSampleCollection UGMCE_OrganicMovementCmp::PredictMovementFuture(const FTransform& FromOrigin,
-	const FRotator& ControllerRotation, const FQuat& MeshOffset, bool bIncludeHistory)
+void UGMCE_OrganicMovementCmp::RunTrajectoryPrediction(const FGMCE_TrajectoryPredictionInput& Input, bool bIncludeHistory,
+	FGMCE_MovementSampleCollection& OutPredictions)
 {
-	const float TimePerSample = 1.f / TrajectorySimSampleRate;
-	const int32 TotalSimulatedSamples = FMath::TruncToInt32(TrajectorySimSampleRate * TrajectorySimSeconds);
+	if (bCacheTrajectoryPrediction && bHasCachedTrajectoryInput && Input.CanReuseIntegrationFrom(CachedTrajectoryInput, TrajectoryCacheVelocityTolerance))
+	{
+		// Nothing that drives the prediction has changed, so the last integration still holds; it only needs
+		// turning to face our new starting rotation.
+		TrajectoryPredictionBuffers.OffsetYaw(
+			Input.Origin.GetRotation().Rotator().Yaw - CachedTrajectoryInput.Origin.GetRotation().Rotator().Yaw,
+			Input.ControllerRotation.Yaw - CachedTrajectoryInput.ControllerRotation.Yaw);
 
-	const int32 TotalCollectionSize = TotalSimulatedSamples + 1 + (bIncludeHistory ? MovementSamples.Num() : 0);
+		// Keep comparing against what was actually integrated, so small drifts can't add up unnoticed.
+		CachedTrajectoryInput.Origin = Input.Origin;
+		CachedTrajectoryInput.ControllerRotation = Input.ControllerRotation;
+	}
+	else
+	{
+		IntegrateTrajectory(Input, TrajectoryPredictionBuffers);
+		CachedTrajectoryInput = Input;
+		CachedTrajectoryInput.GroundHits = {};
+		bHasCachedTrajectoryInput = true;
+	}
 	
-	FGMCE_MovementSample SimulatedSample = LastMovementSample;
-	FGMCE_MovementSampleCollection Predictions;
-	Predictions.Samples.Reserve(TotalCollectionSize);
+	TrajectoryPredictionBuffers.TransformToOriginSpace(Input.Origin);
+
+	OutPredictions.Samples.Reset(Input.NumSamples + (bIncludeHistory ? MovementSamples.Num() : 0));
 
 	if (bIncludeHistory)
 	{
-		Predictions.Samples.Append(GetMovementHistory(false).Samples);
+		GetMovementHistoryView().AppendTo(OutPredictions.Samples);
 	}
 
-	FVector PredictedAcceleration;
+	TrajectoryPredictionBuffers.AppendSamples(Input, OutPredictions.Samples);
+}
+
+bool UGMCE_OrganicMovementCmp::CanPredictTrajectoryInParallel() const
+{
+	// Synchronous collision probes have to be traced from the game thread.
+	return bPredictTrajectoryInParallel && (!bTrajectoryPredictCollisions || bTrajectoryAsyncCollisions);
+}
+
+void UGMCE_OrganicMovementCmp::GatherTrajectoryPredictionInput(const FTransform& FromOrigin,
+	const FRotator& ControllerRotation, const FQuat& MeshOffset, FGMCE_TrajectoryPredictionInput& OutInput)
+{
+	const int32 SampleRate = GetEffectiveTrajectorySimSampleRate();
+	const float TimePerSample = 1.f / SampleRate;
+
+	OutInput.Origin = FromOrigin;
+	OutInput.ControllerRotation = ControllerRotation;
+	OutInput.MeshOffsetRotation = MeshOffset.Rotator();
+	OutInput.TimePerSample = TimePerSample;
+	OutInput.NumSamples = FMath::TruncToInt32(SampleRate * GetEffectiveTrajectorySimSeconds());
+
 	FRotator RotationVelocity;
 	FVector TempVector;
 	
-	GetCurrentAccelerationRotationVelocityFromHistory(PredictedAcceleration, RotationVelocity, EGMCE_TrajectoryRotationType::Component);
+	GetCurrentAccelerationRotationVelocityFromHistory(TempVector, RotationVelocity, EGMCE_TrajectoryRotationType::Component);
 	RotationVelocity = FRotator(0.f, FMath::Clamp(RotationVelocity.Yaw, -RotationRate, RotationRate), 0.f);
-	FRotator RotationVelocityPerSample = RotationVelocity * TimePerSample;
+	OutInput.RotationVelocityPerSample = RotationVelocity * TimePerSample;
 
 	FRotator TravelRotation;
 	GetCurrentAccelerationRotationVelocityFromHistory(TempVector, TravelRotation, EGMCE_TrajectoryRotationType::Travel);	
 	
 	FRotator ControllerRotationVelocity;
 	GetCurrentAccelerationRotationVelocityFromHistory(TempVector, ControllerRotationVelocity, EGMCE_TrajectoryRotationType::Controller);
-	FRotator ControllerRotationVelocityPerSample = FRotator(0.f, ControllerRotationVelocity.Yaw, 0.f) * TimePerSample;
+	OutInput.ControllerRotationVelocityPerSample = FRotator(0.f, ControllerRotationVelocity.Yaw, 0.f) * TimePerSample;
 
 	FRotator MeshOffsetRotationVelocity;
 	GetCurrentAccelerationRotationVelocityFromHistory(TempVector, MeshOffsetRotationVelocity, EGMCE_TrajectoryRotationType::MeshOffset);
-	FRotator MeshOffsetRotationVelocityPerSample = FRotator(0.f, MeshOffsetRotationVelocity.Yaw, 0.f) * TimePerSample;
+	OutInput.MeshOffsetRotationVelocityPerSample = FRotator(0.f, MeshOffsetRotationVelocity.Yaw, 0.f) * TimePerSample;
 
-	EGMC_MovementMode EffectiveMovementMode = GetMovementMode();
+	OutInput.MovementMode = GetMovementMode();
 	const FVector InputVector = PreProcessInputVector(RawInputVector);
-	PredictedAcceleration = InputVector * GetInputAcceleration();
-	PredictedAcceleration.Z = 0.f;
+	OutInput.InitialAcceleration = InputVector * GetInputAcceleration();
+	OutInput.InitialAcceleration.Z = 0.f;
 
 	FRotator RotationToUse;
 	if (bTrajectoryUsesControllerRotation)
@@ -1349,28 +1457,129 @@ FGMCE_MovementSampleCollection UGMCE_OrganicMovementCmp::PredictMovementFuture(c
 	}
 	
 	RotationToUse.Yaw = FMath::Min(RotationToUse.Yaw, RotationRate);
-	FRotator AccelerationRotation = RotationToUse * TimePerSample;
+	OutInput.AccelerationRotation = RotationToUse * TimePerSample;
+
+	if (bTrajectoryUsesControllerRotation && bTrajectoryStopsAtControllerRotation)
+	{
+		// If we use controller rotation, we stop when we're near our current rotation.
+		const float ControllerYawDelta = FMath::Abs(FRotator::NormalizeAxis(GetControllerRotation_GMC().Yaw) - FRotator::NormalizeAxis(ControllerRotation.Yaw));
+		OutInput.bStopAtControllerRotation = ControllerYawDelta <= 0.5f;
+		OutInput.AccelerationRotationDecay = 1.f;
+	}
+	else
+	{
+		// If we're using velocity rotation, we need to decay our rotation a bit.
+		OutInput.bStopAtControllerRotation = false;
+		OutInput.AccelerationRotationDecay = TrajectoryRotationDecay ? TrajectoryRotationDecay : 1.1f;
+	}
+	
+	OutInput.BrakingDeceleration = GetBrakingDeceleration();
+
+	// The minimum is only exposed through the clamp itself; the clamp of a negligible deceleration is the minimum.
+	OutInput.MinDeceleration = ClampToMinDeceleration(FVector(-UE_KINDA_SMALL_NUMBER, 0.f, 0.f)).Size();
+	OutInput.BrakingFriction = IsAirborne() ? 1.f : GetGroundFriction();
+	OutInput.GroundFriction = GetGroundFriction();
+	OutInput.MaxSpeed = GetMaxPredictionSpeed(InputVector);
+	OutInput.InputAcceleration = GetInputAcceleration();
+	OutInput.InitialVelocity = GetLinearVelocity_GMC();
+	OutInput.Gravity = GetGravity();
+	OutInput.MaxTimeStep = MaxTimeStep;
+	OutInput.MaxGroundedVelocityZ = MaxGroundedVelocityZ;
+	OutInput.MaxStepUpHeight = GetMaxStepUpHeight();
+	OutInput.MaxStepDownHeight = GetMaxStepDownHeight();
+	OutInput.bInputPresent = IsInputPresent();
+	OutInput.bPredictCollisions = bTrajectoryPredictCollisions && TrajectorySignificance >= TrajectoryCollisionMinSignificance;
+	OutInput.bAsyncCollisions = OutInput.bPredictCollisions && bTrajectoryAsyncCollisions;
+	OutInput.TraceWorld = OutInput.bPredictCollisions && !OutInput.bAsyncCollisions ? GetWorld() : nullptr;
+	OutInput.TraceIgnoredActor = OutInput.TraceWorld ? GetOwner() : nullptr;
+}
+
+void UGMCE_OrganicMovementCmp::CollectTrajectoryGroundTraces()
+{
+	const UWorld* World = GetWorld();
+	
+	TrajectoryGroundHits.SetNum(PendingTrajectoryGroundTraces.Num());
+	for (int32 Idx = 0; Idx < PendingTrajectoryGroundTraces.Num(); Idx++)
+	{
+		FTraceDatum Datum;
+		if (World && World->QueryTraceData(PendingTrajectoryGroundTraces[Idx], Datum))
+		{
+			// No hits just means there was nothing under the probe.
+			TrajectoryGroundHits[Idx] = Datum.OutHits.IsEmpty() ? FHitResult() : Datum.OutHits[0];
+		}
+		else
+		{
+			TrajectoryGroundHits[Idx].Reset();
+		}
+	}
+	PendingTrajectoryGroundTraces.Reset();
+}
+
+void UGMCE_OrganicMovementCmp::QueueTrajectoryGroundTraces(const FGMCE_TrajectoryPredictionBuffers& Buffers)
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+	
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(GMCETrajectoryGroundProbe), false, GetOwner());
 	
-	float BrakingDeceleration = GetBrakingDeceleration();
-	float BrakingFriction = IsAirborne() ? 1.f : GetGroundFriction();
-	float MaxSpeed = GetMaxPredictionSpeed(InputVector);
+	PendingTrajectoryGroundTraces.Reset(Buffers.Num());
+	for (int32 Idx = 0; Idx < Buffers.Num(); Idx++)
+	{
+		PendingTrajectoryGroundTraces.Emplace(World->AsyncLineTraceByChannel(EAsyncTraceType::Single,
+			Buffers.ProbeStarts[Idx], Buffers.ProbeEnds[Idx], ECC_Visibility, Params));
+	}
+	TrajectoryGroundTraceFrame = GFrameCounter;
+}
+
+namespace
+{
+	/// Raise a non-zero deceleration to at least the given size.
+	FVector ClampTrajectoryDeceleration(const FVector& Deceleration, float MinDeceleration)
+	{
+		const float Size = Deceleration.Size();
+		return Size > 0.f && Size < MinDeceleration ? Deceleration * (MinDeceleration / Size) : Deceleration;
+	}
+
+	/// True if either horizontal component changes sign between the two vectors.
+	bool TrajectoryDirectionsDifferXY(const FVector& A, const FVector& B)
+	{
+		return A.X * B.X < 0.f || A.Y * B.Y < 0.f;
+	}
+
+	/// True if the vertical component changes sign between the two vectors.
+	bool TrajectoryDirectionsDifferZ(const FVector& A, const FVector& B)
+	{
+		return A.Z * B.Z < 0.f;
+	}
+}
 
-	const bool bZeroFriction = BrakingFriction == 0.f;
-	const bool bNoBrakes = BrakingDeceleration == 0.f;
+void UGMCE_OrganicMovementCmp::IntegrateTrajectory(const FGMCE_TrajectoryPredictionInput& Input,
+	FGMCE_TrajectoryPredictionBuffers& Output)
+{
+	Output.Reset(Input.NumSamples);
+
+	const float TimePerSample = Input.TimePerSample;
+	const FVector OriginLocation = Input.Origin.GetLocation();
+	const bool bZeroFriction = Input.BrakingFriction == 0.f;
+
+	EGMC_MovementMode EffectiveMovementMode = Input.MovementMode;
+	FVector PredictedAcceleration = Input.InitialAcceleration;
+	float BrakingFriction = Input.BrakingFriction;
+	
+	FVector CurrentLocation = OriginLocation;
+	FRotator CurrentRotation = Input.Origin.GetRotation().Rotator();
+	FRotator CurrentControllerRotation = Input.ControllerRotation;
+	FRotator CurrentMeshOffsetRotation = Input.MeshOffsetRotation;
+	FVector CurrentVelocity = Input.InitialVelocity;
+
+	FRotator RotationVelocityPerSample = Input.RotationVelocityPerSample;
+	FRotator ControllerRotationVelocityPerSample = Input.ControllerRotationVelocityPerSample;
+	FRotator MeshOffsetRotationVelocityPerSample = Input.MeshOffsetRotationVelocityPerSample;
+	FRotator AccelerationRotation = Input.AccelerationRotation;
 	
-	FVector CurrentLocation = FromOrigin.GetLocation();
-	FRotator CurrentRotation = FromOrigin.GetRotation().Rotator();
-	FRotator CurrentControllerRotation = ControllerRotation;
-	FRotator CurrentMeshOffsetRotation = MeshOffset.Rotator();
-	FVector CurrentVelocity = GetLinearVelocity_GMC();
-
-	const FVector InitialAccel = PredictedAcceleration;
-	const FVector InitialVel = CurrentVelocity;
 	FVector Deceleration;
-	float DistanceTraveled = 0.f;
-	int SampleCount = 0;
 
-	for (int32 Idx = 0; Idx < TotalSimulatedSamples; Idx++)
+	for (int32 Idx = 0; Idx < Input.NumSamples; Idx++)
 	{
 		if (!RotationVelocityPerSample.IsNearlyZero())
 		{
@@ -1391,11 +1600,11 @@ FGMCE_MovementSampleCollection UGMCE_OrganicMovementCmp::PredictMovementFuture(c
 		if (EffectiveMovementMode == EGMC_MovementMode::Airborne)
 		{
 			// *singing a'la Idina Menzel* I guess I'm not... defying gravity.. 
-			CurrentVelocity += GetGravity() * TimePerSample;
+			CurrentVelocity += Input.Gravity * TimePerSample;
 		}
 		
 		const float DecelerationScale = FMath::Clamp(1.f - (PredictedAcceleration.GetSafeNormal() | CurrentVelocity.GetSafeNormal()), 0.f, 1.f);
-		Deceleration = GetBrakingDeceleration() * DecelerationScale * -CurrentVelocity.GetSafeNormal() * BrakingFriction;
+		Deceleration = Input.BrakingDeceleration * DecelerationScale * -CurrentVelocity.GetSafeNormal() * BrakingFriction;
 
 		if (EffectiveMovementMode == EGMC_MovementMode::Airborne && Deceleration.Z < 0.f)
 		{
@@ -1404,17 +1613,17 @@ FGMCE_MovementSampleCollection UGMCE_OrganicMovementCmp::PredictMovementFuture(c
 		}
 
 		FVector PreviousAcceleration = PredictedAcceleration;
-		if (!Deceleration.IsZero() && (EffectiveMovementMode == EGMC_MovementMode::Airborne || !IsInputPresent()))
+		if (!Deceleration.IsZero() && (EffectiveMovementMode == EGMC_MovementMode::Airborne || !Input.bInputPresent))
 		{
-			Deceleration = ClampToMinDeceleration(Deceleration);
+			Deceleration = ClampTrajectoryDeceleration(Deceleration, Input.MinDeceleration);
 			PredictedAcceleration += Deceleration;
 		}
 
-		if (DirectionsDifferXY(PreviousAcceleration, PredictedAcceleration))
+		if (TrajectoryDirectionsDifferXY(PreviousAcceleration, PredictedAcceleration))
 		{
 			PredictedAcceleration = FVector(0.f, 0.f, PredictedAcceleration.Z);
 		}
-		if (DirectionsDifferZ(PreviousAcceleration, PredictedAcceleration))
+		if (TrajectoryDirectionsDifferZ(PreviousAcceleration, PredictedAcceleration))
 		{
 			PredictedAcceleration = FVector(PredictedAcceleration.X, PredictedAcceleration.Y, 0.f);
 		}
@@ -1430,7 +1639,7 @@ FGMCE_MovementSampleCollection UGMCE_OrganicMovementCmp::PredictMovementFuture(c
 				float RemainingTime = TimePerSample;
 				while (RemainingTime >= 1e-6f && !CurrentVelocity.IsZero())
 				{
-					const float dt = RemainingTime > MaxTimeStep && !bZeroFriction ?
+					const float dt = RemainingTime > Input.MaxTimeStep && !bZeroFriction ?
 						FMath::Min(MaxPredictedTrajectoryTimeStep, RemainingTime * 0.5f) : RemainingTime;
 					RemainingTime -= dt;
 
@@ -1462,38 +1671,56 @@ FGMCE_MovementSampleCollection UGMCE_OrganicMovementCmp::PredictMovementFuture(c
 
 			CurrentVelocity += PredictedAcceleration * TimePerSample;
 
-			CurrentVelocity = CurrentVelocity.GetClampedToMaxSize2D(MaxSpeed);
+			CurrentVelocity = CurrentVelocity.GetClampedToMaxSize2D(Input.MaxSpeed);
 		}
 
-		if (EffectiveMovementMode == EGMC_MovementMode::Grounded && CurrentVelocity.Z < MaxGroundedVelocityZ)
+		if (EffectiveMovementMode == EGMC_MovementMode::Grounded && CurrentVelocity.Z < Input.MaxGroundedVelocityZ)
 		{
 			// Stick to the ground if we're not exceeding the max grounded velocity.
 			// If we're predicting collisions anyway, we'll adapt to a slope if needed.
 			CurrentVelocity.Z = 0.f;
 		}
 
-		const FVector PreviousLocation = CurrentLocation;
 		CurrentLocation += CurrentVelocity * TimePerSample;
 		bool bUseAsMark = false;
 
 		const float PredictedDrop = CurrentVelocity.Z * TimePerSample;
 
-		if (bTrajectoryPredictCollisions)
+		if (Input.bPredictCollisions)
 		{
-			FVector Start = CurrentLocation + FVector::UpVector * GetMaxStepUpHeight();
-			FVector End = CurrentLocation - FVector::UpVector * (EffectiveMovementMode == EGMC_MovementMode::Grounded ? GetMaxStepDownHeight() : PredictedDrop);
+			FVector Start = CurrentLocation + FVector::UpVector * Input.MaxStepUpHeight;
+			FVector End = CurrentLocation - FVector::UpVector * (EffectiveMovementMode == EGMC_MovementMode::Grounded ? Input.MaxStepDownHeight : PredictedDrop);
+			Output.SetProbe(Idx, Start, End);
 
 			FHitResult Hit;
-			UKismetSystemLibrary::LineTraceSingle(this, Start, End,
-				UEngineTypes::ConvertToTraceType(ECC_Visibility), false, { },
-				EDrawDebugTrace::None, Hit, true);
+			bool bHasHit = true;
+			if (Input.bAsyncCollisions)
+			{
+				// Use what the previous prediction's probe for this sample found. It was close to this one, so
+				// only take the height from it.
+				bHasHit = Input.GroundHits.IsValidIndex(Idx) && Input.GroundHits[Idx].IsSet();
+				if (bHasHit)
+				{
+					Hit = Input.GroundHits[Idx].GetValue();
+					Hit.Location.X = CurrentLocation.X;
+					Hit.Location.Y = CurrentLocation.Y;
+				}
+			}
+			else if (Input.TraceWorld)
+			{
+				const FCollisionQueryParams Params(SCENE_QUERY_STAT(GMCETrajectoryGroundProbe), false, Input.TraceIgnoredActor);
+				Input.TraceWorld->LineTraceSingleByChannel(Hit, Start, End, ECC_Visibility, Params);
+			}
+			else
+			{
+				bHasHit = false;
+			}
 			
-			if (!Hit.bStartPenetrating)
+			if (bHasHit && !Hit.bStartPenetrating)
 			{
 				if (Hit.bBlockingHit && (FMath::Abs(Hit.Location.Z - CurrentLocation.Z) > 2.f))
 				{
 					CurrentLocation = Hit.Location;
-					// CurrentVelocity.Z = (CurrentLocation.Z - PreviousLocation.Z) / TimePerSample;
 				}
 
 				if (EffectiveMovementMode == EGMC_MovementMode::Grounded && !Hit.bBlockingHit)
@@ -1501,7 +1728,6 @@ FGMCE_MovementSampleCollection UGMCE_OrganicMovementCmp::PredictMovementFuture(c
 					// Handle transition to falling.
 					EffectiveMovementMode = EGMC_MovementMode::Airborne;
 					PredictedAcceleration = FVector::ZeroVector;
-					BrakingDeceleration = BrakingDecelerationAirborne;
 					BrakingFriction = 1.f;
 					bUseAsMark = true;
 				}
@@ -1511,83 +1737,153 @@ FGMCE_MovementSampleCollection UGMCE_OrganicMovementCmp::PredictMovementFuture(c
 					// Handle transition to ground
 					EffectiveMovementMode = EGMC_MovementMode::Grounded;
 					CurrentVelocity.Z = 0.f;
-					PredictedAcceleration = InitialAccel;
-					PredictedAcceleration = PredictedAcceleration.GetClampedToMaxSize(GetInputAcceleration());
+					PredictedAcceleration = Input.InitialAcceleration;
+					PredictedAcceleration = PredictedAcceleration.GetClampedToMaxSize(Input.InputAcceleration);
 					PredictedAcceleration.Z = 0.f;
-					BrakingDeceleration = BrakingDecelerationGrounded;
-					BrakingFriction = GetGroundFriction();
+					BrakingFriction = Input.GroundFriction;
 					bUseAsMark = true;
 				}				
 			}
 		}
 
-		const FTransform NewTransform = FTransform(CurrentRotation.Quaternion(), CurrentLocation);
-		const FTransform NewRelativeTransform = NewTransform.GetRelativeTransform(FromOrigin);
-
-		const FRotator FacingRotation = NewTransform.GetRotation().Rotator() - MeshOffset.Rotator();
+		Output.SetSample(Idx, CurrentLocation - OriginLocation, CurrentVelocity, PredictedAcceleration,
+			CurrentRotation.Yaw, CurrentControllerRotation.Yaw, CurrentMeshOffsetRotation.Yaw, bUseAsMark);
 
-		const FTransform ActorTransform = FTransform(FacingRotation, CurrentLocation);
-
-		DistanceTraveled += (CurrentLocation - PreviousLocation).Size();
-		
-		SimulatedSample = FGMCE_MovementSample();
-		SimulatedSample.RelativeTransform = NewRelativeTransform;
-		SimulatedSample.RelativeLinearVelocity = FromOrigin.InverseTransformVectorNoScale(CurrentVelocity);
-		SimulatedSample.WorldTransform = NewTransform;
-		SimulatedSample.WorldLinearVelocity = CurrentVelocity;
-		SimulatedSample.AccumulatedSeconds = TimePerSample * (Idx + 1);
-		SimulatedSample.ControllerRotation = CurrentControllerRotation;
-		SimulatedSample.MeshComponentRelativeRotation = CurrentMeshOffsetRotation.Quaternion();
-		SimulatedSample.ActorWorldTransform = ActorTransform;
-		SimulatedSample.ActorWorldRotation = ActorTransform.GetRotation().Rotator();
-		SimulatedSample.Acceleration = PredictedAcceleration;
-		SimulatedSample.bUseAsMarker = bUseAsMark;
-
-		Predictions.Samples.Emplace(SimulatedSample);
-
-		SampleCount++;
-
-		if (bTrajectoryUsesControllerRotation && bTrajectoryStopsAtControllerRotation)
-		{
-			float ControllerYawDelta = FMath::Abs(FRotator::NormalizeAxis(GetControllerRotation_GMC().Yaw) - FRotator::NormalizeAxis(ControllerRotation.Yaw));
-			if (ControllerYawDelta <= 0.5f)
-			{
-				AccelerationRotation = FRotator::ZeroRotator;
-				ControllerRotationVelocityPerSample = FRotator::ZeroRotator;
-			}
+		if (Input.bStopAtControllerRotation)
+		{
+			AccelerationRotation = FRotator::ZeroRotator;
+			ControllerRotationVelocityPerSample = FRotator::ZeroRotator;
 		}
 		
 		// Rotate acceleration at the end, so we can handle deceleration in a sane fashion.
 		if (!AccelerationRotation.IsNearlyZero())
 		{
 			PredictedAcceleration = AccelerationRotation.RotateVector(PredictedAcceleration);
-			if (!bTrajectoryUsesControllerRotation || !bTrajectoryStopsAtControllerRotation)
-			{
-				// If we use controller rotation, we stop when we're near our current rotation.
-				// If we're using velocity rotation, we need to decay our rotation a bit.
-				AccelerationRotation.Yaw /= TrajectoryRotationDecay ? TrajectoryRotationDecay : 1.1f;
-			}
+			AccelerationRotation.Yaw /= Input.AccelerationRotationDecay;
 		}
 	}
-
-	return Predictions;	
 }
 
 void UGMCE_OrganicMovementCmp::UpdateTrajectoryPrediction()
 {
 	FTransform OriginTransform;
 	FQuat MeshOffsetRotation;
+	GetTrajectoryPredictionOrigin(OriginTransform, MeshOffsetRotation);
+	PredictedTrajectory = PredictMovementFuture(OriginTransform, FRotator(0.f, GetControllerRotation_GMC().Yaw, 0.f), MeshOffsetRotation, true);	
+}
+
+void UGMCE_OrganicMovementCmp::ExportPredictedTrajectory(FPoseSearchQueryTrajectory& OutTrajectory, const TArray<float>& SampleTimes) const
+{
+	if (SampleTimes.IsEmpty())
+	{
+		PredictedTrajectory.ExportToPoseSearchQueryTrajectory(OutTrajectory);
+	}
+	else
+	{
+		PredictedTrajectory.ExportToPoseSearchQueryTrajectory(OutTrajectory, SampleTimes);
+	}
+}
+
+void UGMCE_OrganicMovementCmp::GetTrajectoryPredictionOrigin(FTransform& OutOrigin, FQuat& OutMeshOffset) const
+{
 	if (bTrajectoryUsesMesh && IsValid(SkeletalMesh))
 	{
-		OriginTransform = SkeletalMesh->GetComponentTransform();
-		MeshOffsetRotation = SkeletalMesh->GetRelativeRotation().Quaternion();
+		OutOrigin = SkeletalMesh->GetComponentTransform();
+		OutMeshOffset = SkeletalMesh->GetRelativeRotation().Quaternion();
 	}
 	else
 	{
-		OriginTransform = UpdatedComponent->GetComponentTransform();
-		MeshOffsetRotation = FQuat::Identity;
+		OutOrigin = UpdatedComponent->GetComponentTransform();
+		OutMeshOffset = FQuat::Identity;
 	}
-	PredictedTrajectory = PredictMovementFuture(OriginTransform, FRotator(0.f, GetControllerRotation_GMC().Yaw, 0.f), MeshOffsetRotation, true);	
+}
+
+void UGMCE_OrganicMovementCmp::UpdateTrajectorySignificance()
+{
+	if (TrajectorySignificanceOverride >= 0.f)
+	{
+		TrajectorySignificance = FMath::Min(TrajectorySignificanceOverride, 1.f);
+		return;
+	}
+
+	const APawn* Pawn = GetPawnOwner();
+	// Only a local player's own pawn is always fully significant; AI pawns are locally controlled wherever they
+	// have authority, and are exactly the ones we want to scale down.
+	if (!bTrajectorySignificanceEnabled || !Pawn || (Pawn->IsPlayerControlled() && Pawn->IsLocallyControlled()))
+	{
+		TrajectorySignificance = 1.f;
+		return;
+	}
+
+	// Find the closest thing anyone is viewing from. The subsystem gathers these once a frame for every pawn.
+	const FVector Location = Pawn->GetActorLocation();
+	float ClosestDistanceSquared = TNumericLimits<float>::Max();
+	if (TrajectorySubsystem.IsValid())
+	{
+		for (const FVector& ViewLocation : TrajectorySubsystem->GetViewerLocations())
+		{
+			ClosestDistanceSquared = FMath::Min(ClosestDistanceSquared, FVector::DistSquared(Location, ViewLocation));
+		}
+	}
+
+	float Significance = 1.f;
+	if (ClosestDistanceSquared < TNumericLimits<float>::Max())
+	{
+		const float Distance = FMath::Sqrt(ClosestDistanceSquared);
+		Significance = 1.f - FMath::SmoothStep(TrajectorySignificanceDistance.X, TrajectorySignificanceDistance.Y, Distance);
+	}
+
+	if (!IsNetMode(NM_DedicatedServer) && !Pawn->WasRecentlyRendered(0.2f))
+	{
+		// Nobody on this machine can see us, so a rough trajectory will do.
+		Significance *= TrajectoryOffscreenSignificanceScale;
+	}
+
+	// Snap to a level, so the history size, sample rate and prediction length only change when we cross one;
+	// otherwise a pawn at any middling distance would change its prediction layout every frame, defeating the
+	// prediction cache and misplacing async ground hits. Round up, so we never drop below the minimum.
+	Significance = FMath::Max(Significance, TrajectoryMinSignificance);
+	const float Level = FMath::CeilToFloat(Significance * TrajectorySignificanceLevels) / TrajectorySignificanceLevels;
+
+	// Don't change level until we're clearly past the boundary, so a pawn sitting on one doesn't flicker.
+	constexpr float Hysteresis = 0.05f;
+	const bool bClearlyAbove = Significance > TrajectorySignificance + Hysteresis;
+	const bool bClearlyBelow = Significance < TrajectorySignificance - 1.f / TrajectorySignificanceLevels - Hysteresis;
+	if (bClearlyAbove || bClearlyBelow)
+	{
+		TrajectorySignificance = Level;
+	}
+}
+
+int32 UGMCE_OrganicMovementCmp::GetEffectiveMaxTrajectorySamples() const
+{
+	if (TrajectorySignificance >= 1.f) return MaxTrajectorySamples;
+
+	// Step in blocks of 16 so that small changes in significance don't resize the history every frame.
+	const int32 Scaled = Align(FMath::CeilToInt32(MaxTrajectorySamples * TrajectorySignificance), 16);
+	return FMath::Clamp(Scaled, FMath::Min(16, MaxTrajectorySamples), MaxTrajectorySamples);
+}
+
+float UGMCE_OrganicMovementCmp::GetEffectiveTrajectoryHistoryPeriod() const
+{
+	const float Period = TrajectoryHistoryPeriod ? TrajectoryHistoryPeriod : SMALL_NUMBER;
+	if (TrajectorySignificance >= 1.f) return Period;
+
+	// Spread the smaller history out over the same window of time.
+	return FMath::Max(Period, TrajectoryHistorySeconds / GetEffectiveMaxTrajectorySamples());
+}
+
+int32 UGMCE_OrganicMovementCmp::GetEffectiveTrajectorySimSampleRate() const
+{
+	if (TrajectorySignificance >= 1.f) return TrajectorySimSampleRate;
+	
+	return FMath::Max(FMath::RoundToInt32(TrajectorySimSampleRate * TrajectorySignificance), FMath::Min(5, TrajectorySimSampleRate));
+}
+
+float UGMCE_OrganicMovementCmp::GetEffectiveTrajectorySimSeconds() const
+{
+	// Distant pawns only need the near future; never drop below half of it.
+	return TrajectorySimSeconds * FMath::Lerp(0.5f, 1.f, TrajectorySignificance);
 }
 
 FGMCE_MovementSample UGMCE_OrganicMovementCmp::GetMovementSampleFromCurrentState() const
@@ -1631,32 +1927,60 @@ FGMCE_MovementSample UGMCE_OrganicMovementCmp::GetMovementSampleFromCurrentState
 
 void UGMCE_OrganicMovementCmp::AddNewMovementSample(const FGMCE_MovementSample& Sample)
 {
-	const float GameSeconds = UKismetSystemLibrary::GetGameTimeInSeconds(GetWorld());
+	AddMovementSampleAt(Sample, GetTrajectoryHistoryTime());
+}
+
+float UGMCE_OrganicMovementCmp::GetTrajectoryHistoryTime() const
+{
+	// A fixed-rate grid is only shared between machines if they all lay it over the same clock.
+	if (bTrajectoryHistoryFixedRate) return UGMCE_UtilityLibrary::GetSynchronizedWorldTime(GetOwner());
+
+	return UKismetSystemLibrary::GetGameTimeInSeconds(GetWorld());
+}
+
+void UGMCE_OrganicMovementCmp::AddMovementSampleAt(const FGMCE_MovementSample& Sample, float GameSeconds)
+{
+	const int32 MaxSamples = GetEffectiveMaxTrajectorySamples();
+	if (MovementSamples.Max() != MaxSamples)
+	{
+		MovementSamples.SetCapacity(MaxSamples);
+	}
+
+	// Older samples are stored in world space against absolute time, so they don't need touching here; anything
+	// relative to the new sample is worked out when it's read.
+	MovementSamples.Add(Sample, GameSeconds);
+	
 	if (LastTrajectoryGameSeconds != 0.f)
 	{
-		const float DeltaSeconds = GameSeconds - LastTrajectoryGameSeconds;
 		const float DeltaDistance = Sample.DistanceFrom(LastMovementSample);
-		const FTransform DeltaTransform = LastMovementSample.WorldTransform.GetRelativeTransform(Sample.WorldTransform);
-
-		for (auto& OldSample : MovementSamples)
-		{
-			OldSample.PrependRelativeOffset(DeltaTransform, -DeltaSeconds);
-		}
-
 		CullMovementSampleHistory(FMath::IsNearlyZero(DeltaDistance), Sample);
 	}
 
-	MovementSamples.Emplace(Sample);
+	if (bTrajectoryHistoryKeyframeReduction)
+	{
+		FGMCE_MovementHistoryTolerances Tolerances;
+		Tolerances.Position = TrajectoryHistoryPositionTolerance;
+		Tolerances.Rotation = TrajectoryHistoryRotationTolerance;
+		Tolerances.ControllerYaw = TrajectoryHistoryControllerYawTolerance;
+		Tolerances.MeshYaw = TrajectoryHistoryMeshYawTolerance;
+		Tolerances.Velocity = TrajectoryHistoryVelocityTolerance;
+		Tolerances.Acceleration = TrajectoryHistoryAccelerationTolerance;
+		MovementSamples.ReduceKeyframes(Tolerances, HistoryEstimateSeconds);
+	}
+
 	LastMovementSample = Sample;
-	LastTrajectoryGameSeconds = GameSeconds;		
+	LastTrajectoryGameSeconds = GameSeconds;
+	UpdateHistoryEstimates();
 }
 
 void UGMCE_OrganicMovementCmp::CullMovementSampleHistory(bool bIsNearlyZero, const FGMCE_MovementSample& LatestSample)
 {
-	const FGMCE_MovementSample FirstSample = MovementSamples.First();
-	const float FirstSampleTime = FirstSample.AccumulatedSeconds;
+	// The newest sample is the one we're culling against, and is always kept.
+	if (MovementSamples.Num() < 2) return;
+	
+	const float FirstSampleTime = MovementSamples.GetAccumulatedSeconds(0);
 
-	if (bIsNearlyZero && !FirstSample.IsZeroSample())
+	if (bIsNearlyZero && !MovementSamples.IsZeroSample(0))
 	{
 		// We were moving, and stopped.
 		if (EffectiveTrajectoryTimeDomain == 0.f)
@@ -1671,37 +1995,94 @@ void UGMCE_OrganicMovementCmp::CullMovementSampleHistory(bool bIsNearlyZero, con
 		EffectiveTrajectoryTimeDomain = 0.f;
 	}
 
-	MovementSamples.RemoveAll([&](const FGMCE_MovementSample& TestSample)
+	if (LatestSample.IsZeroSample())
 	{
-		if (TestSample.IsZeroSample() && LatestSample.IsZeroSample())
+		// We don't need duplicate zero motion samples, they just clutter the history. Since every sample added
+		// while motionless clears out the one before it, they only ever sit right behind the newest sample.
+		while (MovementSamples.Num() > 1 && MovementSamples.IsZeroSample(MovementSamples.Num() - 2))
 		{
-			// We don't need duplicate zero motion samples, they just clutter the history.
-			return true;
+			MovementSamples.RemoveAt(MovementSamples.Num() - 2);
 		}
+	}
 
-		if (TestSample.AccumulatedSeconds < -TrajectoryHistorySeconds)
+	// Samples are in time order, so anything too old is at the front.
+	while (MovementSamples.Num() > 1)
+	{
+		const float SampleSeconds = MovementSamples.GetAccumulatedSeconds(0);
+		const bool bTooOld = SampleSeconds < -TrajectoryHistorySeconds;
+
+		// If a time horizon is in effect, prune everything before our zero motion moment.
+		const bool bBeforeHorizon = EffectiveTrajectoryTimeDomain != 0.f && SampleSeconds < EffectiveTrajectoryTimeDomain;
+
+		if (!bTooOld && !bBeforeHorizon) break;
+		
+		MovementSamples.PopOldest();
+	}
+}
+
+void UGMCE_OrganicMovementCmp::UpdateMovementSamples_Implementation()
+{
+	const float GameSeconds = GetTrajectoryHistoryTime();
+
+	if (bTrajectoryHistoryFixedRate)
+	{
+		const double Period = FMath::Max(1.0 / FMath::Max(TrajectoryHistoryFixedSampleRate, 1), static_cast<double>(GetEffectiveTrajectoryHistoryPeriod()));
+
+		// Also covers a client which hasn't synchronized its clock with the server yet.
+		if (GameSeconds < Period) return;
+
+		if (LastTrajectoryGameSeconds != 0.f && GameSeconds < LastTrajectoryGameSeconds - Period)
 		{
-			// Sample is too old for the buffer.
-			return true;
+			// The synchronized clock was corrected backwards past the grid; start over rather than wait for it.
+			MovementSamples.Reset();
+			LastTrajectoryGameSeconds = 0.f;
 		}
 
-		if (EffectiveTrajectoryTimeDomain != 0.f && (TestSample.AccumulatedSeconds < EffectiveTrajectoryTimeDomain))
+		if (LastTrajectoryGameSeconds == 0.f)
 		{
-			// Time horizon is in effect, prune everything before our zero motion moment.
-			return true;
+			// Nothing to interpolate from yet; snap the first sample back onto the grid.
+			TrajectoryHistoryGridIndex = FMath::FloorToInt64(GameSeconds / Period);
+			TrajectoryHistoryGridPeriod = Period;
+			AddMovementSampleAt(GetMovementSampleFromCurrentState(), static_cast<float>(TrajectoryHistoryGridIndex * Period));
+			return;
 		}
 
-		// Keep the sample
-		return false;
-	});		
-}
+		if (Period != TrajectoryHistoryGridPeriod)
+		{
+			// The spacing changed (significance stretches it); carry on from the last point of the new grid at or
+			// before the last sample.
+			TrajectoryHistoryGridIndex = FMath::FloorToInt64(LastTrajectoryGameSeconds / Period);
+			if ((TrajectoryHistoryGridIndex + 1) * Period <= LastTrajectoryGameSeconds) TrajectoryHistoryGridIndex++;
+			TrajectoryHistoryGridPeriod = Period;
+		}
 
-void UGMCE_OrganicMovementCmp::UpdateMovementSamples_Implementation()
-{
-	const float GameSeconds = UKismetSystemLibrary::GetGameTimeInSeconds(GetWorld());
-	const float Period = TrajectoryHistoryPeriod ? TrajectoryHistoryPeriod : SMALL_NUMBER;
+		int64 GridIndex = TrajectoryHistoryGridIndex + 1;
+		if (GameSeconds < GridIndex * Period) return;
+
+		// After a hitch, don't bother with grid points that would fall straight out of the history window.
+		GridIndex = FMath::Max(GridIndex, FMath::CeilToInt64((GameSeconds - TrajectoryHistorySeconds) / Period));
+
+		// Every grid point crossed since the last sample lies between that sample and our current state.
+		const FGMCE_MovementSample Previous = LastMovementSample;
+		const FGMCE_MovementSample Current = GetMovementSampleFromCurrentState();
+		const double PreviousSeconds = LastTrajectoryGameSeconds;
+		for (; GridIndex * Period <= GameSeconds; GridIndex++)
+		{
+			const double GridSeconds = GridIndex * Period;
+			const float Alpha = static_cast<float>((GridSeconds - PreviousSeconds) / (GameSeconds - PreviousSeconds));
+			FGMCE_MovementSample Sample = Previous.Lerp(Current, Alpha);
+
+			// Lerp doesn't renormalize its rotations, and these are going to be stored.
+			Sample.WorldTransform.NormalizeRotation();
+			Sample.ActorWorldTransform.NormalizeRotation();
+			Sample.MeshComponentRelativeRotation.Normalize();
+			AddMovementSampleAt(Sample, static_cast<float>(GridSeconds));
+			TrajectoryHistoryGridIndex = GridIndex;
+		}
+		return;
+	}
 	
-	if (GameSeconds - LastTrajectoryGameSeconds > Period)
+	if (GameSeconds - LastTrajectoryGameSeconds > GetEffectiveTrajectoryHistoryPeriod())
 	{
 		AddNewMovementSample(GetMovementSampleFromCurrentState());
 	}		
@@ -1710,50 +2091,38 @@ void UGMCE_OrganicMovementCmp::UpdateMovementSamples_Implementation()
 void UGMCE_OrganicMovementCmp::GetCurrentAccelerationRotationVelocityFromHistory(FVector& OutAcceleration,
 	FRotator& OutRotationVelocity, const EGMCE_TrajectoryRotationType& RotationType) const
 {
-	const auto HistoryArray = MovementSamples;
-	if (HistoryArray.IsEmpty())
-	{
-		OutAcceleration = FVector::ZeroVector;
-		OutRotationVelocity = FRotator::ZeroRotator;
-		return;
-	}
-	
-	for (int32 Idx = HistoryArray.Num() - 1; Idx >= 0; Idx--)
-	{
-		const FGMCE_MovementSample Sample = HistoryArray[Idx];
-
-		if (LastMovementSample.AccumulatedSeconds - Sample.AccumulatedSeconds >= 0.1f)
-		{
-			OutRotationVelocity = LastMovementSample.GetRotationVelocityFrom(Sample, RotationType);
-			OutAcceleration = LastMovementSample.GetAccelerationFrom(Sample);
-			return;
-		}
-	}
-
-	OutRotationVelocity = FRotator::ZeroRotator;
-	OutAcceleration = FVector::ZeroVector;
+	OutAcceleration = HistoryAccelerationEstimate;
+	OutRotationVelocity = HistoryRotationVelocityEstimates[static_cast<int32>(RotationType)];
 }
 
 FVector UGMCE_OrganicMovementCmp::GetCurrentVelocityFromHistory()
 {
-	const auto HistoryArray = MovementSamples;
-	if (HistoryArray.IsEmpty())
+	return HistoryVelocityEstimate;
+}
+
+void UGMCE_OrganicMovementCmp::UpdateHistoryEstimates()
+{
+	HistoryVelocityEstimate = FVector::ZeroVector;
+	HistoryAccelerationEstimate = FVector::ZeroVector;
+	for (FRotator& Estimate : HistoryRotationVelocityEstimates)
 	{
-		return FVector::ZeroVector;
+		Estimate = FRotator::ZeroRotator;
 	}
 	
-	for (int32 Idx = HistoryArray.Num() - 1; Idx >= 0; Idx--)
+	// Newest sample at least a tenth of a second older than our latest one.
+	const FGMCE_MovementHistoryView History = GetMovementHistoryView();
+	const int32 Idx = History.FindLastAtOrBefore(LastMovementSample.AccumulatedSeconds - HistoryEstimateSeconds);
+	if (Idx == INDEX_NONE) return;
+
+	const FGMCE_MovementSample Sample = History->GetSample(Idx);
+	const float TimeDelta = LastMovementSample.AccumulatedSeconds - Sample.AccumulatedSeconds;
+	
+	HistoryVelocityEstimate = (LastMovementSample.WorldTransform.GetLocation() - Sample.WorldTransform.GetLocation()) / TimeDelta;
+	HistoryAccelerationEstimate = LastMovementSample.GetAccelerationFrom(Sample);
+	for (int32 Type = 0; Type < NumTrajectoryRotationTypes; Type++)
 	{
-		const FGMCE_MovementSample Sample = HistoryArray[Idx];
-		float TimeDelta = LastMovementSample.AccumulatedSeconds - Sample.AccumulatedSeconds;
-		
-		if (TimeDelta >= 0.1f)
-		{
-			return (LastMovementSample.WorldTransform.GetLocation() - Sample.WorldTransform.GetLocation()) / TimeDelta;
-		}
+		HistoryRotationVelocityEstimates[Type] = LastMovementSample.GetRotationVelocityFrom(Sample, static_cast<EGMCE_TrajectoryRotationType>(Type));
 	}
-
-	return FVector::ZeroVector;
 }
 
 void UGMCE_OrganicMovementCmp::EnableRagdoll()
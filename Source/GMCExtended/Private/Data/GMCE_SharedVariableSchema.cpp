@@ -0,0 +1,278 @@
+﻿#include "Data/GMCE_SharedVariableSchema.h"
+
+#include "GMCExtendedLog.h"
+#include "Animation/AnimMontage.h"
+
+#define CHECK_DEFAULT_VALUE(TypeName) \
+	case EGMCE_SharedVariableType::TypeName: \
+	{ \
+		TGMCE_SharedVariableTraits<EGMCE_SharedVariableType::TypeName>::ValueType Value {}; \
+		return GetDefaultValue(Value); \
+	}
+
+#define PARSE_DEFAULT_VALUE(TypeName) \
+	case EGMCE_SharedVariableType::TypeName: \
+	{ \
+		TGMCE_SharedVariableTraits<EGMCE_SharedVariableType::TypeName>::ValueType Value {}; \
+		if (!Definition.GetDefaultValue(Value)) \
+		{ \
+			UE_LOG(LogGMCExtended, Warning, TEXT("Shared variable schema %s has a default value for %s which can't be parsed; using the type's default."), \
+				*GetName(), *Definition.VariableName.ToString()); \
+		} \
+		Parsed.Set<decltype(Value)>(MoveTemp(Value)); \
+		break; \
+	}
+
+bool FGMCE_SharedVariableDefinition::GetDefaultValue(bool& OutValue) const
+{
+	OutValue = false;
+	if (DefaultValue.IsEmpty() || DefaultValue == TEXT("0") || DefaultValue.Equals(TEXT("false"), ESearchCase::IgnoreCase)) return true;
+	if (DefaultValue == TEXT("1") || DefaultValue.Equals(TEXT("true"), ESearchCase::IgnoreCase))
+	{
+		OutValue = true;
+		return true;
+	}
+	return false;
+}
+
+bool FGMCE_SharedVariableDefinition::GetDefaultValue(uint8& OutValue) const
+{
+	OutValue = 0;
+	int32 Value = 0;
+	if (DefaultValue.IsEmpty()) return true;
+	if (!LexTryParseString(Value, *DefaultValue) || Value < 0 || Value > MAX_uint8) return false;
+
+	// HalfByte variables only replicate the low four bits.
+	if (Type == EGMCE_SharedVariableType::HalfByte && Value > 15) return false;
+
+	OutValue = static_cast<uint8>(Value);
+	return true;
+}
+
+bool FGMCE_SharedVariableDefinition::GetDefaultValue(int32& OutValue) const
+{
+	OutValue = 0;
+	return DefaultValue.IsEmpty() || LexTryParseString(OutValue, *DefaultValue);
+}
+
+bool FGMCE_SharedVariableDefinition::GetDefaultValue(float& OutValue) const
+{
+	OutValue = 0.f;
+	return DefaultValue.IsEmpty() || LexTryParseString(OutValue, *DefaultValue);
+}
+
+bool FGMCE_SharedVariableDefinition::GetDefaultValue(double& OutValue) const
+{
+	OutValue = 0.0;
+	return DefaultValue.IsEmpty() || LexTryParseString(OutValue, *DefaultValue);
+}
+
+bool FGMCE_SharedVariableDefinition::GetDefaultValue(FVector2D& OutValue) const
+{
+	OutValue = FVector2D::ZeroVector;
+	return DefaultValue.IsEmpty() || OutValue.InitFromString(DefaultValue);
+}
+
+bool FGMCE_SharedVariableDefinition::GetDefaultValue(FVector& OutValue) const
+{
+	OutValue = FVector::ZeroVector;
+	return DefaultValue.IsEmpty() || OutValue.InitFromString(DefaultValue);
+}
+
+bool FGMCE_SharedVariableDefinition::GetDefaultValue(FRotator& OutValue) const
+{
+	OutValue = FRotator::ZeroRotator;
+	return DefaultValue.IsEmpty() || OutValue.InitFromString(DefaultValue);
+}
+
+bool FGMCE_SharedVariableDefinition::GetDefaultValue(AActor*& OutValue) const
+{
+	// There's no actor to refer to until the level is loaded.
+	OutValue = nullptr;
+	return DefaultValue.IsEmpty();
+}
+
+bool FGMCE_SharedVariableDefinition::GetDefaultValue(UActorComponent*& OutValue) const
+{
+	OutValue = nullptr;
+	return DefaultValue.IsEmpty();
+}
+
+bool FGMCE_SharedVariableDefinition::GetDefaultValue(UAnimMontage*& OutValue) const
+{
+	OutValue = DefaultMontage;
+	return true;
+}
+
+bool FGMCE_SharedVariableDefinition::GetDefaultValue(FName& OutValue) const
+{
+	OutValue = DefaultValue.IsEmpty() ? NAME_None : FName(*DefaultValue);
+	return true;
+}
+
+bool FGMCE_SharedVariableDefinition::GetDefaultValue(FGameplayTag& OutValue) const
+{
+	OutValue = FGameplayTag::EmptyTag;
+	if (DefaultValue.IsEmpty()) return true;
+
+	OutValue = FGameplayTag::RequestGameplayTag(FName(*DefaultValue.TrimStartAndEnd()), false);
+	return OutValue.IsValid();
+}
+
+bool FGMCE_SharedVariableDefinition::GetDefaultValue(FGameplayTagContainer& OutValue) const
+{
+	OutValue.Reset();
+
+	TArray<FString> TagNames;
+	DefaultValue.ParseIntoArray(TagNames, TEXT(","));
+	for (const FString& TagName : TagNames)
+	{
+		const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(FName(*TagName.TrimStartAndEnd()), false);
+		if (!Tag.IsValid())
+		{
+			OutValue.Reset();
+			return false;
+		}
+		OutValue.AddTag(Tag);
+	}
+	return true;
+}
+
+bool FGMCE_SharedVariableDefinition::GetDefaultValue(FInstancedStruct& OutValue) const
+{
+	OutValue = DefaultStruct;
+	return true;
+}
+
+bool FGMCE_SharedVariableDefinition::IsDefaultValueValid() const
+{
+	switch (Type)
+	{
+	CHECK_DEFAULT_VALUE(Bool)
+	CHECK_DEFAULT_VALUE(HalfByte)
+	CHECK_DEFAULT_VALUE(Byte)
+	CHECK_DEFAULT_VALUE(Int)
+	CHECK_DEFAULT_VALUE(SinglePrecisionFloat)
+	CHECK_DEFAULT_VALUE(CompressedSinglePrecisionFloat)
+	CHECK_DEFAULT_VALUE(DoublePrecisionFloat)
+	CHECK_DEFAULT_VALUE(CompressedDoublePrecisionFloat)
+	CHECK_DEFAULT_VALUE(TruncatedDoublePrecisionFloat)
+	CHECK_DEFAULT_VALUE(CompressedVector2D)
+	CHECK_DEFAULT_VALUE(CompressedVector)
+	CHECK_DEFAULT_VALUE(CompressedRotator)
+	CHECK_DEFAULT_VALUE(ActorReference)
+	CHECK_DEFAULT_VALUE(ActorComponentReference)
+	CHECK_DEFAULT_VALUE(AnimMontageReference)
+	CHECK_DEFAULT_VALUE(Name)
+	CHECK_DEFAULT_VALUE(GameplayTag)
+	CHECK_DEFAULT_VALUE(GameplayTagContainer)
+	CHECK_DEFAULT_VALUE(InstancedStruct)
+	default:
+		return false;
+	}
+}
+
+void UGMCE_SharedVariableSchema::ParseDefaultValues()
+{
+	ParsedDefaultValues.Reset(Variables.Num());
+	for (const FGMCE_SharedVariableDefinition& Definition : Variables)
+	{
+		FGMCE_SharedVariableValue& Parsed = ParsedDefaultValues.AddDefaulted_GetRef();
+		switch (Definition.Type)
+		{
+		PARSE_DEFAULT_VALUE(Bool)
+		PARSE_DEFAULT_VALUE(HalfByte)
+		PARSE_DEFAULT_VALUE(Byte)
+		PARSE_DEFAULT_VALUE(Int)
+		PARSE_DEFAULT_VALUE(SinglePrecisionFloat)
+		PARSE_DEFAULT_VALUE(CompressedSinglePrecisionFloat)
+		PARSE_DEFAULT_VALUE(DoublePrecisionFloat)
+		PARSE_DEFAULT_VALUE(CompressedDoublePrecisionFloat)
+		PARSE_DEFAULT_VALUE(TruncatedDoublePrecisionFloat)
+		PARSE_DEFAULT_VALUE(CompressedVector2D)
+		PARSE_DEFAULT_VALUE(CompressedVector)
+		PARSE_DEFAULT_VALUE(CompressedRotator)
+		PARSE_DEFAULT_VALUE(ActorReference)
+		PARSE_DEFAULT_VALUE(ActorComponentReference)
+		PARSE_DEFAULT_VALUE(AnimMontageReference)
+		PARSE_DEFAULT_VALUE(Name)
+		PARSE_DEFAULT_VALUE(GameplayTag)
+		PARSE_DEFAULT_VALUE(GameplayTagContainer)
+		PARSE_DEFAULT_VALUE(InstancedStruct)
+		default:
+			// Invalid types are reported, and skipped, when the schema is applied.
+			break;
+		}
+	}
+}
+
+void UGMCE_SharedVariableSchema::PostLoad()
+{
+	Super::PostLoad();
+	ParseDefaultValues();
+}
+
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+
+#define LOCTEXT_NAMESPACE "GMCExtended"
+
+void UGMCE_SharedVariableSchema::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	ParseDefaultValues();
+}
+
+EDataValidationResult UGMCE_SharedVariableSchema::IsDataValid(FDataValidationContext& Context) const
+{
+	EDataValidationResult Result = CombineDataValidationResults(Super::IsDataValid(Context), EDataValidationResult::Valid);
+
+	TSet<TPair<EGMCE_SharedVariableType, FName>> Seen;
+	for (int32 Index = 0; Index < Variables.Num(); Index++)
+	{
+		const FGMCE_SharedVariableDefinition& Definition = Variables[Index];
+
+		if (Definition.VariableName.IsNone())
+		{
+			Context.AddError(FText::Format(LOCTEXT("SchemaUnnamed", "Shared variable {0} has no name."), Index));
+			Result = EDataValidationResult::Invalid;
+			continue;
+		}
+
+		if (Definition.Type == EGMCE_SharedVariableType::Invalid)
+		{
+			Context.AddError(FText::Format(LOCTEXT("SchemaInvalidType", "Shared variable {0} has no type."),
+				FText::FromName(Definition.VariableName)));
+			Result = EDataValidationResult::Invalid;
+			continue;
+		}
+
+		if (!Definition.IsDefaultValueValid())
+		{
+			Context.AddError(FText::Format(LOCTEXT("SchemaInvalidDefault", "Shared variable {0} has a default value which can't be parsed as its type."),
+				FText::FromName(Definition.VariableName)));
+			Result = EDataValidationResult::Invalid;
+		}
+
+		bool bAlreadySeen = false;
+		Seen.Add({ Definition.Type, Definition.VariableName }, &bAlreadySeen);
+		if (bAlreadySeen)
+		{
+			Context.AddError(FText::Format(LOCTEXT("SchemaDuplicate", "Shared variable {0} is declared more than once with the same type."),
+				FText::FromName(Definition.VariableName)));
+			Result = EDataValidationResult::Invalid;
+		}
+
+		if (Definition.Type == EGMCE_SharedVariableType::Bool &&
+			Definition.InterpolationRule != EGMC_InterpolationFunction::NearestNeighbour)
+		{
+			Context.AddWarning(FText::Format(LOCTEXT("SchemaBoolInterpolation", "Bool shared variable {0} is interpolated, and cannot be packed with other flags."),
+				FText::FromName(Definition.VariableName)));
+		}
+	}
+
+	return Result;
+}
+
+#undef LOCTEXT_NAMESPACE
+#endif
@@ -0,0 +1,73 @@
+#include "Support/GMCECompactMovementSample.h"
+
+FGMCE_CompactMovementSample::FGMCE_CompactMovementSample(const FGMCE_MovementSample& Sample, float InSeconds, const FVector& Origin)
+{
+	const FVector WorldLocation = Sample.WorldTransform.GetLocation();
+
+	Seconds = InSeconds;
+	Location = FVector3f(WorldLocation - Origin);
+	ActorOffset = FVector3f(Sample.ActorWorldTransform.GetLocation() - WorldLocation);
+	CompressQuat(Sample.WorldTransform.GetRotation(), Rotation);
+	CompressQuat(Sample.ActorWorldTransform.GetRotation(), ActorRotation);
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		LinearVelocity[Axis] = FFloat16(Sample.WorldLinearVelocity[Axis]);
+		Acceleration[Axis] = FFloat16(Sample.Acceleration[Axis]);
+	}
+	ControllerYaw = FRotator::CompressAxisToShort(Sample.ControllerRotation.Yaw);
+	MeshComponentRelativeYaw = FRotator::CompressAxisToShort(Sample.MeshComponentRelativeRotation.Rotator().Yaw);
+	ActorDeltaYaw = FRotator::CompressAxisToShort(Sample.ActorDeltaRotation.Yaw);
+	bUseAsMarker = Sample.bUseAsMarker;
+}
+
+FGMCE_MovementSample FGMCE_CompactMovementSample::Expand(const FVector& Origin) const
+{
+	const FVector WorldLocation = GetWorldLocation(Origin);
+	const FQuat ActorQuat = DecompressQuat(ActorRotation);
+
+	FGMCE_MovementSample Sample;
+	Sample.AccumulatedSeconds = Seconds;
+	Sample.WorldTransform = FTransform(GetWorldRotation(), WorldLocation);
+	Sample.WorldLinearVelocity = GetWorldLinearVelocity();
+	Sample.ActorWorldTransform = FTransform(ActorQuat, WorldLocation + FVector(ActorOffset));
+	Sample.ActorWorldRotation = ActorQuat.Rotator();
+	Sample.ActorDeltaRotation = FRotator(0.f, FRotator::DecompressAxisFromShort(ActorDeltaYaw), 0.f).GetNormalized();
+	Sample.MeshComponentRelativeRotation = FRotator(0.f, FRotator::DecompressAxisFromShort(MeshComponentRelativeYaw), 0.f).Quaternion();
+	Sample.ControllerRotation = GetControllerRotation();
+	Sample.Acceleration = GetAcceleration();
+	Sample.bUseAsMarker = bUseAsMarker;
+	return Sample;
+}
+
+void FGMCE_CompactMovementSample::CompressQuat(const FQuat& Quat, int16 (&OutComponents)[4])
+{
+	// Q and -Q are the same rotation; keep W positive so that identical rotations always pack identically.
+	FQuat Normalized = Quat.GetNormalized();
+	if (Normalized.W < 0.f) Normalized = -Normalized;
+
+	OutComponents[0] = static_cast<int16>(FMath::RoundToInt32(Normalized.X * MAX_int16));
+	OutComponents[1] = static_cast<int16>(FMath::RoundToInt32(Normalized.Y * MAX_int16));
+	OutComponents[2] = static_cast<int16>(FMath::RoundToInt32(Normalized.Z * MAX_int16));
+	OutComponents[3] = static_cast<int16>(FMath::RoundToInt32(Normalized.W * MAX_int16));
+}
+
+FQuat FGMCE_CompactMovementSample::DecompressQuat(const int16 (&Components)[4])
+{
+	return FQuat(Components[0], Components[1], Components[2], Components[3]).GetNormalized();
+}
+
+FArchive& operator<<(FArchive& Ar, FGMCE_CompactMovementSample& Sample)
+{
+	Ar << Sample.Seconds;
+	Ar << Sample.Location;
+	Ar << Sample.ActorOffset;
+	for (int16& Component : Sample.Rotation) Ar << Component;
+	for (int16& Component : Sample.ActorRotation) Ar << Component;
+	for (FFloat16& Component : Sample.LinearVelocity) Ar << Component;
+	for (FFloat16& Component : Sample.Acceleration) Ar << Component;
+	Ar << Sample.ControllerYaw;
+	Ar << Sample.MeshComponentRelativeYaw;
+	Ar << Sample.ActorDeltaYaw;
+	Ar << Sample.bUseAsMarker;
+	return Ar;
+}
@@ -0,0 +1,297 @@
+#include "Support/GMCEMovementHistory.h"
+
+namespace
+{
+	/// Longest run of samples keyframe reduction will drop in a row, to bound the cost of checking a new span.
+	constexpr int32 MaxReducedRun = 64;
+
+	/// How far a yaw is from the shortest-way-round interpolation between two others, in degrees.
+	float YawError(float StartYaw, float EndYaw, float Alpha, float Yaw)
+	{
+		const float Interpolated = StartYaw + FRotator::NormalizeAxis(EndYaw - StartYaw) * Alpha;
+		return FMath::Abs(FRotator::NormalizeAxis(Interpolated - Yaw));
+	}
+}
+
+void FGMCE_MovementHistory::SetCapacity(int32 NewCapacity)
+{
+	NewCapacity = FMath::Max(NewCapacity, 1);
+	if (NewCapacity == Capacity) return;
+
+	// Keep the newest samples, unrolled so that the oldest kept sample lands at physical index 0.
+	const int32 Kept = FMath::Min(Count, NewCapacity);
+	const int32 FirstKept = Count - Kept;
+
+	FGMCE_CompactMovementSampleArray Resized;
+	Resized.SetNumUninitialized(NewCapacity);
+	for (int32 Index = 0; Index < Kept; Index++)
+	{
+		Resized[Index] = Samples[ToPhysical(FirstKept + Index)];
+	}
+	Samples = MoveTemp(Resized);
+
+	Head = 0;
+	Count = Kept;
+	Capacity = NewCapacity;
+}
+
+void FGMCE_MovementHistory::Reset()
+{
+	Head = 0;
+	Count = 0;
+	ReducedSamples.Reset();
+	ReducedThroughSeconds = TNumericLimits<float>::Lowest();
+}
+
+void FGMCE_MovementHistory::Add(const FGMCE_MovementSample& Sample, float InGameSeconds)
+{
+	if (Capacity == 0) SetCapacity(1);
+
+	int32 Physical;
+	if (Count == Capacity)
+	{
+		// Full; overwrite the oldest sample.
+		Physical = Head;
+		Head = Head + 1 == Capacity ? 0 : Head + 1;
+	}
+	else
+	{
+		Count++;
+		Physical = ToPhysical(Count - 1);
+	}
+
+	const FVector Location = Sample.WorldTransform.GetLocation();
+	if (Count == 1)
+	{
+		Origin = Location;
+	}
+	else
+	{
+		RebaseIfNeeded(Location);
+	}
+
+	Samples[Physical] = FGMCE_CompactMovementSample(Sample, InGameSeconds, Origin);
+}
+
+void FGMCE_MovementHistory::RebaseIfNeeded(const FVector& Location)
+{
+	// Single precision is good to a few hundredths of a unit out to here.
+	constexpr double MaxOriginDistanceSquared = 100000.0 * 100000.0;
+	if (FVector::DistSquared(Location, Origin) < MaxOriginDistanceSquared) return;
+
+	const FVector3f Delta = FVector3f(Location - Origin);
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		Samples[ToPhysical(Index)].Rebase(Delta);
+	}
+	for (FGMCE_CompactMovementSample& Sample : ReducedSamples)
+	{
+		Sample.Rebase(Delta);
+	}
+	Origin = Location;
+}
+
+void FGMCE_MovementHistory::PopOldest()
+{
+	if (Count == 0) return;
+
+	Head = Head + 1 == Capacity ? 0 : Head + 1;
+	Count--;
+}
+
+void FGMCE_MovementHistory::RemoveAt(int32 Index)
+{
+	if (!IsValidIndex(Index)) return;
+
+	for (int32 Next = Index + 1; Next < Count; Next++)
+	{
+		Samples[ToPhysical(Next - 1)] = Samples[ToPhysical(Next)];
+	}
+	Count--;
+}
+
+bool FGMCE_MovementHistory::ReduceKeyframes(const FGMCE_MovementHistoryTolerances& Tolerances, float UnreducedSeconds)
+{
+	// Find the oldest sample not considered yet; everything after the last one considered is near the newest end.
+	int32 Candidate = Count - 2;
+	while (Candidate > 1 && GetGameSeconds(Candidate - 1) > ReducedThroughSeconds)
+	{
+		Candidate--;
+	}
+
+	// A candidate is only considered once the sample after it has left the unreduced window too, so the newest
+	// sample at or before the window's start is always kept.
+	bool bDropped = false;
+	while (Candidate >= 1 && Candidate + 1 < Count && GetGameSeconds(Candidate) > ReducedThroughSeconds &&
+		GetAccumulatedSeconds(Candidate + 1) <= -UnreducedSeconds)
+	{
+		ReducedThroughSeconds = GetGameSeconds(Candidate);
+		if (TryDropKeyframe(Candidate, Tolerances))
+		{
+			// The next sample has moved down into the candidate's place.
+			bDropped = true;
+		}
+		else
+		{
+			Candidate++;
+		}
+	}
+
+	return bDropped;
+}
+
+bool FGMCE_MovementHistory::TryDropKeyframe(int32 Index, const FGMCE_MovementHistoryTolerances& Tolerances)
+{
+	const FGMCE_CompactMovementSample& Anchor = Samples[ToPhysical(Index - 1)];
+	const FGMCE_CompactMovementSample& Candidate = Samples[ToPhysical(Index)];
+	const FGMCE_CompactMovementSample& Next = Samples[ToPhysical(Index + 1)];
+
+	if (Candidate.IsMarker())
+	{
+		// Markers flag events (leaving the ground, landing) which interpolation can't bring back.
+		ReducedSamples.Reset();
+		return false;
+	}
+
+	const float StartSeconds = Anchor.GetSeconds();
+	const float SpanSeconds = Next.GetSeconds() - StartSeconds;
+	const FVector StartLocation = Anchor.GetWorldLocation(Origin);
+	const FVector EndLocation = Next.GetWorldLocation(Origin);
+	const FVector StartVelocity = Anchor.GetWorldLinearVelocity();
+	const FVector EndVelocity = Next.GetWorldLinearVelocity();
+	const FVector StartAcceleration = Anchor.GetAcceleration();
+	const FVector EndAcceleration = Next.GetAcceleration();
+	const FVector StartActorLocation = Anchor.GetActorWorldLocation(Origin);
+	const FVector EndActorLocation = Next.GetActorWorldLocation(Origin);
+	const FQuat StartRotation = Anchor.GetWorldRotation();
+	const FQuat EndRotation = Next.GetWorldRotation();
+	const FQuat StartActorRotation = Anchor.GetActorWorldRotation();
+	const FQuat EndActorRotation = Next.GetActorWorldRotation();
+	const float StartControllerYaw = Anchor.GetControllerRotation().Yaw;
+	const float EndControllerYaw = Next.GetControllerRotation().Yaw;
+	const float StartMeshYaw = Anchor.GetMeshComponentRelativeYaw();
+	const float EndMeshYaw = Next.GetMeshComponentRelativeYaw();
+	const float RotationTolerance = FMath::DegreesToRadians(Tolerances.Rotation);
+
+	auto CanInterpolate = [&](const FGMCE_CompactMovementSample& Sample)
+	{
+		const float Alpha = (Sample.GetSeconds() - StartSeconds) / SpanSeconds;
+		return FVector::DistSquared(FMath::Lerp(StartLocation, EndLocation, Alpha), Sample.GetWorldLocation(Origin)) <= FMath::Square(Tolerances.Position) &&
+			FVector::DistSquared(FMath::Lerp(StartActorLocation, EndActorLocation, Alpha), Sample.GetActorWorldLocation(Origin)) <= FMath::Square(Tolerances.Position) &&
+			FVector::DistSquared(FMath::Lerp(StartVelocity, EndVelocity, Alpha), Sample.GetWorldLinearVelocity()) <= FMath::Square(Tolerances.Velocity) &&
+			FVector::DistSquared(FMath::Lerp(StartAcceleration, EndAcceleration, Alpha), Sample.GetAcceleration()) <= FMath::Square(Tolerances.Acceleration) &&
+			FQuat::Slerp(StartRotation, EndRotation, Alpha).AngularDistance(Sample.GetWorldRotation()) <= RotationTolerance &&
+			FQuat::Slerp(StartActorRotation, EndActorRotation, Alpha).AngularDistance(Sample.GetActorWorldRotation()) <= RotationTolerance &&
+			YawError(StartControllerYaw, EndControllerYaw, Alpha, Sample.GetControllerRotation().Yaw) <= Tolerances.ControllerYaw &&
+			YawError(StartMeshYaw, EndMeshYaw, Alpha, Sample.GetMeshComponentRelativeYaw()) <= Tolerances.MeshYaw;
+	};
+
+	bool bRedundant = SpanSeconds > 0.f && ReducedSamples.Num() < MaxReducedRun && CanInterpolate(Candidate);
+	for (int32 Idx = 0; bRedundant && Idx < ReducedSamples.Num(); Idx++)
+	{
+		// Anything from before the anchor belongs to a span that has already been settled.
+		if (ReducedSamples[Idx].GetSeconds() <= StartSeconds) continue;
+		bRedundant = CanInterpolate(ReducedSamples[Idx]);
+	}
+
+	if (!bRedundant)
+	{
+		// The candidate stays, and becomes the anchor for the next span.
+		ReducedSamples.Reset();
+		return false;
+	}
+
+	ReducedSamples.Add(Candidate);
+	RemoveAt(Index);
+	return true;
+}
+
+FGMCE_MovementSample FGMCE_MovementHistory::GetSample(int32 Index) const
+{
+	FGMCE_MovementSample Sample = Samples[ToPhysical(Index)].Expand(Origin);
+	Sample.AccumulatedSeconds = GetAccumulatedSeconds(Index);
+	Sample.RelativeTransform = GetRelativeTransform(Index);
+	Sample.RelativeLinearVelocity = GetRelativeLinearVelocity(Index);
+	if (Index > 0)
+	{
+		const float Yaw = Samples[ToPhysical(Index)].GetActorWorldRotation().Rotator().Yaw;
+		const float PreviousYaw = Samples[ToPhysical(Index - 1)].GetActorWorldRotation().Rotator().Yaw;
+		Sample.ActorDeltaRotation = FRotator(0.f, FRotator::NormalizeAxis(Yaw - PreviousYaw), 0.f);
+	}
+	return Sample;
+}
+
+FTransform FGMCE_MovementHistory::GetRelativeTransform(int32 Index) const
+{
+	const FTransform World(GetWorldRotation(Index), GetWorldLocation(Index));
+	return World.GetRelativeTransform(FTransform(GetWorldRotation(Count - 1), GetWorldLocation(Count - 1)));
+}
+
+FVector FGMCE_MovementHistory::GetRelativeLinearVelocity(int32 Index) const
+{
+	return GetWorldRotation(Count - 1).UnrotateVector(GetWorldLinearVelocity(Index));
+}
+
+bool FGMCE_MovementHistory::IsZeroSample(int32 Index) const
+{
+	const FGMCE_CompactMovementSample& Sample = Samples[ToPhysical(Index)];
+	const FGMCE_CompactMovementSample& Newest = Samples[ToPhysical(Count - 1)];
+	const FQuat NewestRotation = Newest.GetWorldRotation();
+
+	return NewestRotation.UnrotateVector(Sample.GetWorldLinearVelocity()).IsNearlyZero() &&
+		NewestRotation.UnrotateVector(FVector(Sample.GetOffset() - Newest.GetOffset())).IsNearlyZero() &&
+		(NewestRotation.Inverse() * Sample.GetWorldRotation()).IsIdentity();
+}
+
+int32 FGMCE_MovementHistoryView::LowerBound(float AccumulatedSeconds) const
+{
+	int32 First = 0;
+	int32 Size = Num();
+	while (Size > 0)
+	{
+		const int32 Half = Size / 2;
+		if (History->GetAccumulatedSeconds(First + Half) < AccumulatedSeconds)
+		{
+			First += Half + 1;
+			Size -= Half + 1;
+		}
+		else
+		{
+			Size = Half;
+		}
+	}
+	return First;
+}
+
+int32 FGMCE_MovementHistoryView::FindLastAtOrBefore(float AccumulatedSeconds) const
+{
+	// Find the first sample strictly after the time; the one before it is our answer.
+	int32 First = 0;
+	int32 Size = Num();
+	while (Size > 0)
+	{
+		const int32 Half = Size / 2;
+		if (History->GetAccumulatedSeconds(First + Half) <= AccumulatedSeconds)
+		{
+			First += Half + 1;
+			Size -= Half + 1;
+		}
+		else
+		{
+			Size = Half;
+		}
+	}
+	return First - 1;
+}
+
+void FGMCE_MovementHistoryView::AppendTo(TArray<FGMCE_MovementSample>& OutSamples, bool bOmitLatest) const
+{
+	const int32 OutputCount = bOmitLatest ? Num() - 1 : Num();
+	if (OutputCount <= 0) return;
+	
+	OutSamples.Reserve(OutSamples.Num() + OutputCount);
+	for (int32 Idx = 0; Idx < OutputCount; Idx++)
+	{
+		OutSamples.Emplace(History->GetSample(Idx));
+	}
+}
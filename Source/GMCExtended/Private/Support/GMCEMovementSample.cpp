@@ -54,3 +54,79 @@ void FGMCE_MovementSampleCollection::DrawDebug(const UWorld* World, const FTrans
 		Samples[Idx].DrawDebug(World, FromOrigin, TimelineColor.ToFColor(true), LifeTime);	
 	}
 }
+
+void FGMCE_MovementSampleCollection::ExportToPoseSearchQueryTrajectory(FPoseSearchQueryTrajectory& OutTrajectory) const
+{
+	OutTrajectory.Samples.Reset(Samples.Num());
+	for (const FGMCE_MovementSample& Sample : Samples)
+	{
+		OutTrajectory.Samples.Emplace(static_cast<FPoseSearchQueryTrajectorySample>(Sample));
+	}
+}
+
+void FGMCE_MovementSampleCollection::ExportToPoseSearchQueryTrajectory(FPoseSearchQueryTrajectory& OutTrajectory, TConstArrayView<float> SampleTimes) const
+{
+	OutTrajectory.Samples.Reset(SampleTimes.Num());
+	if (Samples.IsEmpty())
+	{
+		OutTrajectory.Samples.SetNum(SampleTimes.Num());
+		return;
+	}
+
+	SweepTimes(SampleTimes, false, [&](float Time, int32 PrevIdx, int32 NextIdx, float Alpha)
+	{
+		const FTransform& Prev = Samples[PrevIdx].WorldTransform;
+		const FTransform& Next = Samples[NextIdx].WorldTransform;
+
+		FPoseSearchQueryTrajectorySample& Result = OutTrajectory.Samples.AddDefaulted_GetRef();
+		Result.AccumulatedSeconds = Time;
+		Result.Position = FMath::Lerp(Prev.GetTranslation(), Next.GetTranslation(), Alpha);
+		Result.Facing = FQuat::FastLerp(Prev.GetRotation(), Next.GetRotation(), Alpha).GetNormalized();
+	});
+}
+
+void FGMCE_MovementSampleCollection::GetSamplesAtTimes(TConstArrayView<float> Times, bool bExtrapolate, TArray<FGMCE_MovementSample>& OutSamples) const
+{
+	OutSamples.Reserve(OutSamples.Num() + Times.Num());
+	if (Samples.IsEmpty())
+	{
+		OutSamples.AddDefaulted(Times.Num());
+		return;
+	}
+
+	SweepTimes(Times, bExtrapolate, [&](float Time, int32 PrevIdx, int32 NextIdx, float Alpha)
+	{
+		if (PrevIdx == NextIdx)
+		{
+			OutSamples.Add(Samples[PrevIdx]);
+		}
+		else
+		{
+			OutSamples.Emplace(Samples[PrevIdx].Lerp(Samples[NextIdx], Alpha));
+		}
+	});
+}
+
+void FGMCE_MovementSampleCollection::GetWorldTransformsAtTimes(TConstArrayView<float> Times, bool bExtrapolate, TArray<FTransform>& OutTransforms) const
+{
+	OutTransforms.Reserve(OutTransforms.Num() + Times.Num());
+	if (Samples.IsEmpty())
+	{
+		OutTransforms.AddDefaulted(Times.Num());
+		return;
+	}
+
+	SweepTimes(Times, bExtrapolate, [&](float Time, int32 PrevIdx, int32 NextIdx, float Alpha)
+	{
+		const FTransform& Prev = Samples[PrevIdx].WorldTransform;
+		if (PrevIdx == NextIdx)
+		{
+			OutTransforms.Add(Prev);
+			return;
+		}
+
+		const FTransform& Next = Samples[NextIdx].WorldTransform;
+		OutTransforms.Emplace(FQuat::FastLerp(Prev.GetRotation(), Next.GetRotation(), Alpha).GetNormalized(),
+			FMath::Lerp(Prev.GetTranslation(), Next.GetTranslation(), Alpha));
+	});
+}
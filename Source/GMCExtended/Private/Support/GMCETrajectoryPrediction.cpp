@@ -0,0 +1,194 @@
+#include "Support/GMCETrajectoryPrediction.h"
+
+namespace
+{
+	constexpr int32 SimdLanes = 4;
+
+	/// Rotate packed vectors by a basis, writing out = X * AxisX + Y * AxisY + Z * AxisZ, then scale each output
+	/// component. All arrays must be padded to a multiple of four.
+	void RotatePacked(const float* InX, const float* InY, const float* InZ, float* OutX, float* OutY, float* OutZ,
+		const FVector3f& AxisX, const FVector3f& AxisY, const FVector3f& AxisZ, const FVector3f& Scale, int32 Count)
+	{
+		const VectorRegister4Float XX = VectorSetFloat1(AxisX.X * Scale.X);
+		const VectorRegister4Float XY = VectorSetFloat1(AxisX.Y * Scale.Y);
+		const VectorRegister4Float XZ = VectorSetFloat1(AxisX.Z * Scale.Z);
+		const VectorRegister4Float YX = VectorSetFloat1(AxisY.X * Scale.X);
+		const VectorRegister4Float YY = VectorSetFloat1(AxisY.Y * Scale.Y);
+		const VectorRegister4Float YZ = VectorSetFloat1(AxisY.Z * Scale.Z);
+		const VectorRegister4Float ZX = VectorSetFloat1(AxisZ.X * Scale.X);
+		const VectorRegister4Float ZY = VectorSetFloat1(AxisZ.Y * Scale.Y);
+		const VectorRegister4Float ZZ = VectorSetFloat1(AxisZ.Z * Scale.Z);
+
+		for (int32 Idx = 0; Idx < Count; Idx += SimdLanes)
+		{
+			const VectorRegister4Float X = VectorLoad(InX + Idx);
+			const VectorRegister4Float Y = VectorLoad(InY + Idx);
+			const VectorRegister4Float Z = VectorLoad(InZ + Idx);
+
+			VectorStore(VectorMultiplyAdd(Z, ZX, VectorMultiplyAdd(Y, YX, VectorMultiply(X, XX))), OutX + Idx);
+			VectorStore(VectorMultiplyAdd(Z, ZY, VectorMultiplyAdd(Y, YY, VectorMultiply(X, XY))), OutY + Idx);
+			VectorStore(VectorMultiplyAdd(Z, ZZ, VectorMultiplyAdd(Y, YZ, VectorMultiply(X, XZ))), OutZ + Idx);
+		}
+	}
+
+	/// FRotator::Quaternion for a series of rotations which only differ in yaw; the pitch and roll terms are worked
+	/// out once, leaving a single SinCos per rotation.
+	struct FYawQuatBuilder
+	{
+		explicit FYawQuatBuilder(const FRotator& Rotation)
+		{
+			FMath::SinCos(&SinPitch, &CosPitch, FMath::DegreesToRadians(Rotation.Pitch) * 0.5);
+			FMath::SinCos(&SinRoll, &CosRoll, FMath::DegreesToRadians(Rotation.Roll) * 0.5);
+		}
+
+		FQuat operator()(double Yaw) const
+		{
+			double SinYaw, CosYaw;
+			FMath::SinCos(&SinYaw, &CosYaw, FMath::DegreesToRadians(Yaw) * 0.5);
+			return FQuat(
+				CosRoll * SinPitch * SinYaw - SinRoll * CosPitch * CosYaw,
+				-CosRoll * SinPitch * CosYaw - SinRoll * CosPitch * SinYaw,
+				CosRoll * CosPitch * SinYaw - SinRoll * SinPitch * CosYaw,
+				CosRoll * CosPitch * CosYaw + SinRoll * SinPitch * SinYaw);
+		}
+
+		double SinPitch { 0.0 };
+		double CosPitch { 1.0 };
+		double SinRoll { 0.0 };
+		double CosRoll { 1.0 };
+	};
+}
+
+bool FGMCE_TrajectoryPredictionInput::CanReuseIntegrationFrom(const FGMCE_TrajectoryPredictionInput& Other, float VelocityTolerance) const
+{
+	if (bPredictCollisions || Other.bPredictCollisions) return false;
+
+	return NumSamples == Other.NumSamples &&
+		TimePerSample == Other.TimePerSample &&
+		MovementMode == Other.MovementMode &&
+		bInputPresent == Other.bInputPresent &&
+		bStopAtControllerRotation == Other.bStopAtControllerRotation &&
+		InitialVelocity.Equals(Other.InitialVelocity, VelocityTolerance) &&
+		InitialAcceleration.Equals(Other.InitialAcceleration) &&
+		Gravity.Equals(Other.Gravity) &&
+		MeshOffsetRotation.Equals(Other.MeshOffsetRotation) &&
+		RotationVelocityPerSample.Equals(Other.RotationVelocityPerSample) &&
+		ControllerRotationVelocityPerSample.Equals(Other.ControllerRotationVelocityPerSample) &&
+		MeshOffsetRotationVelocityPerSample.Equals(Other.MeshOffsetRotationVelocityPerSample) &&
+		AccelerationRotation.Equals(Other.AccelerationRotation) &&
+		AccelerationRotationDecay == Other.AccelerationRotationDecay &&
+		BrakingDeceleration == Other.BrakingDeceleration &&
+		MinDeceleration == Other.MinDeceleration &&
+		BrakingFriction == Other.BrakingFriction &&
+		GroundFriction == Other.GroundFriction &&
+		MaxSpeed == Other.MaxSpeed &&
+		InputAcceleration == Other.InputAcceleration &&
+		MaxTimeStep == Other.MaxTimeStep &&
+		MaxGroundedVelocityZ == Other.MaxGroundedVelocityZ;
+}
+
+void FGMCE_TrajectoryPredictionBuffers::Reset(int32 InNumSamples)
+{
+	NumSamples = FMath::Max(InNumSamples, 0);
+	const int32 Padded = Align(NumSamples, SimdLanes);
+
+	for (TArray<float>* Column : { &OffsetX, &OffsetY, &OffsetZ, &VelocityX, &VelocityY, &VelocityZ,
+		&AccelerationX, &AccelerationY, &AccelerationZ, &Yaw, &ControllerYaw, &MeshOffsetYaw,
+		&RelativeOffsetX, &RelativeOffsetY, &RelativeOffsetZ, &RelativeVelocityX, &RelativeVelocityY, &RelativeVelocityZ })
+	{
+		// Zeroed so that the padding lanes hold harmless values.
+		Column->SetNumZeroed(Padded);
+	}
+	Markers.Init(false, NumSamples);
+	ProbeStarts.SetNumUninitialized(NumSamples);
+	ProbeEnds.SetNumUninitialized(NumSamples);
+}
+
+void FGMCE_TrajectoryPredictionBuffers::SetSample(int32 Index, const FVector& Offset, const FVector& Velocity,
+	const FVector& Acceleration, float InYaw, float InControllerYaw, float InMeshOffsetYaw, bool bMarker)
+{
+	OffsetX[Index] = Offset.X;
+	OffsetY[Index] = Offset.Y;
+	OffsetZ[Index] = Offset.Z;
+	VelocityX[Index] = Velocity.X;
+	VelocityY[Index] = Velocity.Y;
+	VelocityZ[Index] = Velocity.Z;
+	AccelerationX[Index] = Acceleration.X;
+	AccelerationY[Index] = Acceleration.Y;
+	AccelerationZ[Index] = Acceleration.Z;
+	Yaw[Index] = InYaw;
+	ControllerYaw[Index] = InControllerYaw;
+	MeshOffsetYaw[Index] = InMeshOffsetYaw;
+	Markers[Index] = bMarker;
+}
+
+void FGMCE_TrajectoryPredictionBuffers::OffsetYaw(float YawDelta, float ControllerYawDelta)
+{
+	for (int32 Idx = 0; Idx < NumSamples; Idx++)
+	{
+		Yaw[Idx] += YawDelta;
+		ControllerYaw[Idx] += ControllerYawDelta;
+	}
+}
+
+void FGMCE_TrajectoryPredictionBuffers::SetProbe(int32 Index, const FVector& Start, const FVector& End)
+{
+	ProbeStarts[Index] = Start;
+	ProbeEnds[Index] = End;
+}
+
+void FGMCE_TrajectoryPredictionBuffers::TransformToOriginSpace(const FTransform& Origin)
+{
+	const FQuat InverseRotation = Origin.GetRotation().Inverse();
+	const FVector3f AxisX = FVector3f(InverseRotation.RotateVector(FVector::XAxisVector));
+	const FVector3f AxisY = FVector3f(InverseRotation.RotateVector(FVector::YAxisVector));
+	const FVector3f AxisZ = FVector3f(InverseRotation.RotateVector(FVector::ZAxisVector));
+	const FVector3f InverseScale = FVector3f(FTransform::GetSafeScaleReciprocal(Origin.GetScale3D()));
+	const int32 Padded = Align(NumSamples, SimdLanes);
+
+	// Locations match FTransform::GetRelativeTransform, velocities FTransform::InverseTransformVectorNoScale.
+	RotatePacked(OffsetX.GetData(), OffsetY.GetData(), OffsetZ.GetData(),
+		RelativeOffsetX.GetData(), RelativeOffsetY.GetData(), RelativeOffsetZ.GetData(),
+		AxisX, AxisY, AxisZ, InverseScale, Padded);
+	RotatePacked(VelocityX.GetData(), VelocityY.GetData(), VelocityZ.GetData(),
+		RelativeVelocityX.GetData(), RelativeVelocityY.GetData(), RelativeVelocityZ.GetData(),
+		AxisX, AxisY, AxisZ, FVector3f::OneVector, Padded);
+}
+
+void FGMCE_TrajectoryPredictionBuffers::AppendSamples(const FGMCE_TrajectoryPredictionInput& Input,
+	TArray<FGMCE_MovementSample>& OutSamples) const
+{
+	const FVector OriginLocation = Input.Origin.GetLocation();
+	const FQuat InverseOriginRotation = Input.Origin.GetRotation().Inverse();
+	const FVector InverseOriginScale = FTransform::GetSafeScaleReciprocal(Input.Origin.GetScale3D());
+	const FRotator OriginRotation = Input.Origin.GetRotation().Rotator();
+
+	// Only yaw varies from sample to sample, so each rotation is built straight from it rather than by converting
+	// between rotators and quaternions. The actor faces the sample rotation less the mesh offset.
+	const FRotator ActorRotation = OriginRotation - Input.MeshOffsetRotation;
+	const FYawQuatBuilder SampleQuat(OriginRotation);
+	const FYawQuatBuilder ActorQuat(ActorRotation);
+	const FYawQuatBuilder MeshOffsetQuat(Input.MeshOffsetRotation);
+
+	OutSamples.Reserve(OutSamples.Num() + NumSamples);
+	for (int32 Idx = 0; Idx < NumSamples; Idx++)
+	{
+		const FVector Location = OriginLocation + FVector(OffsetX[Idx], OffsetY[Idx], OffsetZ[Idx]);
+		const FQuat Rotation = SampleQuat(Yaw[Idx]);
+		const float ActorYaw = Yaw[Idx] - Input.MeshOffsetRotation.Yaw;
+
+		FGMCE_MovementSample& Sample = OutSamples.AddDefaulted_GetRef();
+		Sample.RelativeTransform = FTransform(InverseOriginRotation * Rotation,
+			FVector(RelativeOffsetX[Idx], RelativeOffsetY[Idx], RelativeOffsetZ[Idx]), InverseOriginScale);
+		Sample.RelativeLinearVelocity = FVector(RelativeVelocityX[Idx], RelativeVelocityY[Idx], RelativeVelocityZ[Idx]);
+		Sample.WorldTransform = FTransform(Rotation, Location);
+		Sample.WorldLinearVelocity = FVector(VelocityX[Idx], VelocityY[Idx], VelocityZ[Idx]);
+		Sample.AccumulatedSeconds = Input.TimePerSample * (Idx + 1);
+		Sample.ControllerRotation = FRotator(Input.ControllerRotation.Pitch, ControllerYaw[Idx], Input.ControllerRotation.Roll);
+		Sample.MeshComponentRelativeRotation = MeshOffsetQuat(MeshOffsetYaw[Idx]);
+		Sample.ActorWorldTransform = FTransform(ActorQuat(ActorYaw), Location);
+		Sample.ActorWorldRotation = FRotator(ActorRotation.Pitch, ActorYaw, ActorRotation.Roll).GetNormalized();
+		Sample.Acceleration = FVector(AccelerationX[Idx], AccelerationY[Idx], AccelerationZ[Idx]);
+		Sample.bUseAsMarker = Markers[Idx];
+	}
+}
@@ -0,0 +1,106 @@
+﻿#include "Support/GMCE_TrajectorySubsystem.h"
+#include "Async/ParallelFor.h"
+#include "Components/GMCE_OrganicMovementCmp.h"
+#include "GameFramework/PlayerController.h"
+
+void UGMCE_TrajectorySubsystem::RegisterComponent(UGMCE_OrganicMovementCmp* Component)
+{
+	Components.AddUnique(Component);
+}
+
+void UGMCE_TrajectorySubsystem::UnregisterComponent(UGMCE_OrganicMovementCmp* Component)
+{
+	Components.RemoveSwap(Component);
+}
+
+const TArray<FVector>& UGMCE_TrajectorySubsystem::GetViewerLocations()
+{
+	if (ViewerLocationsFrame == GFrameCounter) return ViewerLocations;
+	ViewerLocationsFrame = GFrameCounter;
+
+	// Locally we know the actual camera; on a server, the best we have is each player's pawn.
+	ViewerLocations.Reset();
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* Controller = It->Get();
+		if (!Controller) continue;
+
+		if (Controller->IsLocalController())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			Controller->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewerLocations.Add(ViewLocation);
+		}
+		else if (const APawn* ViewPawn = Controller->GetPawnOrSpectator())
+		{
+			ViewerLocations.Add(ViewPawn->GetActorLocation());
+		}
+	}
+
+	return ViewerLocations;
+}
+
+void UGMCE_TrajectorySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Gather on the game thread; this is the part that reads the rest of the world.
+	int32 NumJobs = 0;
+	for (int32 Idx = Components.Num() - 1; Idx >= 0; Idx--)
+	{
+		UGMCE_OrganicMovementCmp* Component = Components[Idx].Get();
+		if (!Component)
+		{
+			Components.RemoveAtSwap(Idx);
+			continue;
+		}
+		
+		if (!Component->bTrajectoryPredictionQueued) continue;
+		Component->bTrajectoryPredictionQueued = false;
+
+		if (NumJobs == Jobs.Num())
+		{
+			Jobs.AddDefaulted();
+		}
+		FPredictionJob& Job = Jobs[NumJobs++];
+		Job.Component = Component;
+		
+		FTransform Origin;
+		FQuat MeshOffset;
+		Component->GetTrajectoryPredictionOrigin(Origin, MeshOffset);
+		Job.bQueueGroundTraces = Component->BeginTrajectoryPrediction(Origin,
+			FRotator(0.f, Component->GetControllerRotation_GMC().Yaw, 0.f), MeshOffset, Job.Input);
+	}
+
+	if (NumJobs == 0) return;
+
+	// Each job only touches its own component's buffers and history.
+	ParallelFor(NumJobs, [this](int32 Idx)
+	{
+		FPredictionJob& Job = Jobs[Idx];
+		Job.Component->RunTrajectoryPrediction(Job.Input, true, Job.Result);
+	});
+
+	for (int32 Idx = 0; Idx < NumJobs; Idx++)
+	{
+		FPredictionJob& Job = Jobs[Idx];
+		Swap(Job.Component->PredictedTrajectory.Samples, Job.Result.Samples);
+		
+		if (Job.bQueueGroundTraces)
+		{
+			Job.Component->QueueTrajectoryGroundTraces(Job.Component->TrajectoryPredictionBuffers);
+		}
+		Job.Component = nullptr;
+	}
+}
+
+TStatId UGMCE_TrajectorySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGMCE_TrajectorySubsystem, STATGROUP_Tickables);
+}
+
+bool UGMCE_TrajectorySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -69,6 +69,20 @@ FPoseSearchQueryTrajectory UGMCE_UtilityLibrary::ConvertMovementSampleCollection
 	return static_cast<FPoseSearchQueryTrajectory>(MovementSampleCollection);
 }
 
+void UGMCE_UtilityLibrary::ExportMovementSampleCollectionToPoseSearchQueryTrajectory(
+	const FGMCE_MovementSampleCollection& MovementSampleCollection, FPoseSearchQueryTrajectory& Trajectory,
+	const TArray<float>& SampleTimes)
+{
+	if (SampleTimes.IsEmpty())
+	{
+		MovementSampleCollection.ExportToPoseSearchQueryTrajectory(Trajectory);
+	}
+	else
+	{
+		MovementSampleCollection.ExportToPoseSearchQueryTrajectory(Trajectory, SampleTimes);
+	}
+}
+
 float UGMCE_UtilityLibrary::GetSynchronizedWorldTime(UObject* WorldContextObject)
 {
 	UWorld* World;
@@ -0,0 +1,76 @@
+#include "Support/GMCECompactMovementSample.h"
+#include "Support/GMCEMovementHistory.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGMCE_CompactMovementSampleTest, "GMCExtended.Trajectory.CompactMovementSample",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGMCE_CompactMovementSampleTest::RunTest(const FString& Parameters)
+{
+	// Rotations: quantized to 16 bits per component, and Q and -Q must pack identically.
+	{
+		const FQuat Rotation = FRotator(30.f, 200.f, -15.f).Quaternion();
+		const FQuat Negated = -Rotation;
+
+		int16 Packed[4];
+		int16 PackedNegated[4];
+		FGMCE_CompactMovementSample::CompressQuat(Rotation, Packed);
+		FGMCE_CompactMovementSample::CompressQuat(Negated, PackedNegated);
+
+		TestTrue(TEXT("A quaternion and its negation pack identically"), FMemory::Memcmp(Packed, PackedNegated, sizeof(Packed)) == 0);
+		TestTrue(TEXT("Packed W is positive"), Packed[3] >= 0);
+
+		const FQuat Unpacked = FGMCE_CompactMovementSample::DecompressQuat(PackedNegated);
+		TestTrue(FString::Printf(TEXT("Rotation comes back within 0.01 degrees (%.4f)"), FMath::RadiansToDegrees(Unpacked.AngularDistance(Rotation))),
+			FMath::RadiansToDegrees(Unpacked.AngularDistance(Rotation)) <= 0.01f);
+	}
+
+	// Velocity and acceleration: half precision, good to one part in 2048 of each component.
+	{
+		FGMCE_MovementSample Sample;
+		Sample.WorldLinearVelocity = FVector(312.7f, -1234.5f, 5.3f);
+		Sample.Acceleration = FVector(-2048.f, 0.25f, 980.f);
+
+		const FGMCE_MovementSample Unpacked = FGMCE_CompactMovementSample(Sample, 0.f, FVector::ZeroVector).Expand(FVector::ZeroVector);
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			TestTrue(FString::Printf(TEXT("Velocity axis %d: %.3f came back as %.3f"), Axis, Sample.WorldLinearVelocity[Axis], Unpacked.WorldLinearVelocity[Axis]),
+				FMath::Abs(Unpacked.WorldLinearVelocity[Axis] - Sample.WorldLinearVelocity[Axis]) <= FMath::Abs(Sample.WorldLinearVelocity[Axis]) / 2048.f + 1.e-3f);
+			TestTrue(FString::Printf(TEXT("Acceleration axis %d: %.3f came back as %.3f"), Axis, Sample.Acceleration[Axis], Unpacked.Acceleration[Axis]),
+				FMath::Abs(Unpacked.Acceleration[Axis] - Sample.Acceleration[Axis]) <= FMath::Abs(Sample.Acceleration[Axis]) / 2048.f + 1.e-3f);
+		}
+	}
+
+	// Locations: a history far from the world origin, travelling over 1000 m so that its own origin moves.
+	{
+		constexpr int32 NumSamples = 40;
+		const FVector Start(3000000.f, -2000000.f, 50000.f);
+		const FVector Step(2800.f, 1200.f, 0.f);
+
+		FGMCE_MovementHistory History;
+		History.SetCapacity(NumSamples);
+		for (int32 Idx = 0; Idx < NumSamples; Idx++)
+		{
+			FGMCE_MovementSample Sample;
+			Sample.WorldTransform = FTransform(Start + Step * Idx);
+			Sample.ActorWorldTransform = FTransform(Start + Step * Idx + FVector(0.f, 0.f, 90.f));
+			History.Add(Sample, Idx / 30.f);
+		}
+
+		for (int32 Idx = 0; Idx < NumSamples; Idx++)
+		{
+			const FGMCE_MovementSample Sample = History.GetSample(Idx);
+			const FVector Expected = Start + Step * Idx;
+			TestTrue(FString::Printf(TEXT("Location %d is within 0.02 units after rebasing (%.4f off)"), Idx, FVector::Dist(Sample.WorldTransform.GetLocation(), Expected)),
+				FVector::Dist(Sample.WorldTransform.GetLocation(), Expected) <= 0.02f);
+			TestTrue(FString::Printf(TEXT("Actor location %d is within 0.02 units after rebasing"), Idx),
+				FVector::Dist(Sample.ActorWorldTransform.GetLocation(), Expected + FVector(0.f, 0.f, 90.f)) <= 0.02f);
+		}
+	}
+
+	return true;
+}
+
+#endif
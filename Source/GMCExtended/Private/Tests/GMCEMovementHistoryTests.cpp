@@ -0,0 +1,116 @@
+#include "Support/GMCEMovementHistory.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGMCE_MovementHistoryKeyframeTest, "GMCExtended.Trajectory.HistoryKeyframeReduction",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGMCE_MovementHistoryKeyframeTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumSamples = 60;
+	constexpr float SampleRate = 30.f;
+	constexpr float UnreducedSeconds = 0.1f;
+	const FGMCE_MovementHistoryTolerances Tolerances;
+
+	// Walking in a straight line at a steady speed, first with a still camera and then with one swinging about.
+	for (const bool bSwingCamera : { false, true })
+	{
+		FGMCE_MovementHistory History;
+		History.SetCapacity(NumSamples);
+
+		TArray<float> ControllerYaws;
+		for (int32 Idx = 0; Idx < NumSamples; Idx++)
+		{
+			const float Seconds = Idx / SampleRate;
+			ControllerYaws.Add(bSwingCamera ? 90.f * FMath::Sin(Seconds * 3.f) : 0.f);
+
+			FGMCE_MovementSample Sample;
+			Sample.WorldTransform = FTransform(FVector(300.f * Seconds, 0.f, 0.f));
+			Sample.ActorWorldTransform = Sample.WorldTransform;
+			Sample.WorldLinearVelocity = FVector(300.f, 0.f, 0.f);
+			Sample.ControllerRotation = FRotator(0.f, ControllerYaws[Idx], 0.f);
+			History.Add(Sample, Seconds);
+			History.ReduceKeyframes(Tolerances, UnreducedSeconds);
+		}
+
+		const FString Case = bSwingCamera ? TEXT("Swinging camera") : TEXT("Still camera");
+		if (!bSwingCamera)
+		{
+			TestTrue(FString::Printf(TEXT("%s: steady movement reduces to a few keyframes (%d kept)"), *Case, History.Num()), History.Num() <= 6);
+		}
+
+		// Every original sample must come back from the kept ones, controller yaw included.
+		int32 Kept = 0;
+		for (int32 Idx = 0; Idx < NumSamples; Idx++)
+		{
+			const float Seconds = Idx / SampleRate;
+			while (Kept + 1 < History.Num() && History.GetGameSeconds(Kept + 1) < Seconds) Kept++;
+
+			const float StartSeconds = History.GetGameSeconds(Kept);
+			const float EndSeconds = History.GetGameSeconds(FMath::Min(Kept + 1, History.Num() - 1));
+			const float Alpha = EndSeconds > StartSeconds ? (Seconds - StartSeconds) / (EndSeconds - StartSeconds) : 0.f;
+			const float StartYaw = History.GetControllerRotation(Kept).Yaw;
+			const float EndYaw = History.GetControllerRotation(FMath::Min(Kept + 1, History.Num() - 1)).Yaw;
+			const float Yaw = StartYaw + FRotator::NormalizeAxis(EndYaw - StartYaw) * Alpha;
+
+			TestTrue(FString::Printf(TEXT("%s: controller yaw at %.3fs interpolates to %.2f, was %.2f"), *Case, Seconds, Yaw, ControllerYaws[Idx]),
+				FMath::Abs(FRotator::NormalizeAxis(Yaw - ControllerYaws[Idx])) <= Tolerances.ControllerYaw + 0.05f);
+		}
+
+		// The recent tail, which here ends on a sample, is never reduced.
+		const float NewestSeconds = (NumSamples - 1) / SampleRate;
+		const int32 TailCount = FMath::RoundToInt32(UnreducedSeconds * SampleRate) + 1;
+		for (int32 Offset = 0; Offset < TailCount; Offset++)
+		{
+			const int32 Idx = History.Num() - 1 - Offset;
+			TestTrue(FString::Printf(TEXT("%s: tail sample %d kept"), *Case, Offset),
+				Idx >= 0 && FMath::IsNearlyEqual(History.GetGameSeconds(Idx), NewestSeconds - Offset / SampleRate, 1.e-4f));
+		}
+	}
+
+	// Steady movement again, but with a marker and a burst of input partway through; neither may be dropped.
+	{
+		constexpr int32 MarkerIdx = 20;
+		constexpr int32 InputIdx = 35;
+
+		FGMCE_MovementHistory History;
+		History.SetCapacity(NumSamples);
+		for (int32 Idx = 0; Idx < NumSamples; Idx++)
+		{
+			const float Seconds = Idx / SampleRate;
+
+			FGMCE_MovementSample Sample;
+			Sample.WorldTransform = FTransform(FRotator(0.f, Idx * 0.5f, 0.f), FVector(300.f * Seconds, 0.f, 0.f));
+			Sample.ActorWorldTransform = Sample.WorldTransform;
+			Sample.WorldLinearVelocity = FVector(300.f, 0.f, 0.f);
+			Sample.Acceleration = Idx == InputIdx ? FVector(0.f, 1000.f, 0.f) : FVector::ZeroVector;
+			Sample.bUseAsMarker = Idx == MarkerIdx;
+			History.Add(Sample, Seconds);
+			History.ReduceKeyframes(Tolerances, UnreducedSeconds);
+		}
+
+		bool bFoundMarker = false;
+		bool bFoundInput = false;
+		for (int32 Idx = 0; Idx < History.Num(); Idx++)
+		{
+			const FGMCE_MovementSample Sample = History.GetSample(Idx);
+			bFoundMarker |= Sample.bUseAsMarker && FMath::IsNearlyEqual(History.GetGameSeconds(Idx), MarkerIdx / SampleRate, 1.e-4f);
+			bFoundInput |= FMath::IsNearlyEqual(History.GetGameSeconds(Idx), InputIdx / SampleRate, 1.e-4f);
+
+			// Each kept sample's actor delta is against the kept sample before it, however many were dropped between.
+			if (Idx > 0)
+			{
+				const float Expected = History.GetSample(Idx).ActorWorldRotation.Yaw - History.GetSample(Idx - 1).ActorWorldRotation.Yaw;
+				TestTrue(FString::Printf(TEXT("Actor delta at %.3fs is %.2f, expected %.2f"), History.GetGameSeconds(Idx), Sample.ActorDeltaRotation.Yaw, Expected),
+					FMath::IsNearlyEqual(Sample.ActorDeltaRotation.Yaw, Expected, 0.05f));
+			}
+		}
+		TestTrue(TEXT("Marker sample kept"), bFoundMarker);
+		TestTrue(TEXT("Sample with a change of input kept"), bFoundInput);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,100 @@
+#include "Data/GMCE_SharedVariableSchema.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+#include "Misc/DataValidation.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGMCE_SharedVariableSchemaValidationTest, "GMCExtended.SharedVariables.SchemaValidation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+namespace
+{
+	FGMCE_SharedVariableDefinition MakeDefinition(const FName& Name, EGMCE_SharedVariableType Type, const FString& DefaultValue = FString())
+	{
+		FGMCE_SharedVariableDefinition Definition;
+		Definition.VariableName = Name;
+		Definition.Type = Type;
+		Definition.DefaultValue = DefaultValue;
+		return Definition;
+	}
+
+	EDataValidationResult Validate(const TArray<FGMCE_SharedVariableDefinition>& Variables)
+	{
+		UGMCE_SharedVariableSchema* Schema = NewObject<UGMCE_SharedVariableSchema>();
+		Schema->Variables = Variables;
+
+		FDataValidationContext Context;
+		return Schema->IsDataValid(Context);
+	}
+}
+
+bool FGMCE_SharedVariableSchemaValidationTest::RunTest(const FString& Parameters)
+{
+	// The same name with different types is two separate variables, and is fine.
+	TestTrue(TEXT("Distinct variables are valid"), Validate({
+		MakeDefinition(TEXT("Speed"), EGMCE_SharedVariableType::SinglePrecisionFloat),
+		MakeDefinition(TEXT("Speed"), EGMCE_SharedVariableType::Int),
+		MakeDefinition(TEXT("bSprinting"), EGMCE_SharedVariableType::Bool) }) == EDataValidationResult::Valid);
+
+	TestTrue(TEXT("A duplicate name and type is invalid"), Validate({
+		MakeDefinition(TEXT("Speed"), EGMCE_SharedVariableType::SinglePrecisionFloat),
+		MakeDefinition(TEXT("bSprinting"), EGMCE_SharedVariableType::Bool),
+		MakeDefinition(TEXT("Speed"), EGMCE_SharedVariableType::SinglePrecisionFloat) }) == EDataValidationResult::Invalid);
+
+	TestTrue(TEXT("An unnamed variable is invalid"), Validate({
+		MakeDefinition(TEXT("Speed"), EGMCE_SharedVariableType::SinglePrecisionFloat),
+		MakeDefinition(NAME_None, EGMCE_SharedVariableType::Int) }) == EDataValidationResult::Invalid);
+
+	TestTrue(TEXT("A variable without a type is invalid"), Validate({
+		MakeDefinition(TEXT("Speed"), EGMCE_SharedVariableType::Invalid) }) == EDataValidationResult::Invalid);
+
+	TestTrue(TEXT("Parseable default values are valid"), Validate({
+		MakeDefinition(TEXT("bSprinting"), EGMCE_SharedVariableType::Bool, TEXT("true")),
+		MakeDefinition(TEXT("Stance"), EGMCE_SharedVariableType::HalfByte, TEXT("12")),
+		MakeDefinition(TEXT("Speed"), EGMCE_SharedVariableType::SinglePrecisionFloat, TEXT("1.5")),
+		MakeDefinition(TEXT("Aim"), EGMCE_SharedVariableType::CompressedVector, TEXT("X=1 Y=2 Z=3")) }) == EDataValidationResult::Valid);
+
+	TestTrue(TEXT("A default value of the wrong type is invalid"), Validate({
+		MakeDefinition(TEXT("Speed"), EGMCE_SharedVariableType::Int, TEXT("fast")) }) == EDataValidationResult::Invalid);
+
+	TestTrue(TEXT("A default value out of range is invalid"), Validate({
+		MakeDefinition(TEXT("Stance"), EGMCE_SharedVariableType::HalfByte, TEXT("16")) }) == EDataValidationResult::Invalid);
+
+	TestTrue(TEXT("An actor reference can't have a default value"), Validate({
+		MakeDefinition(TEXT("Target"), EGMCE_SharedVariableType::ActorReference, TEXT("SomeActor")) }) == EDataValidationResult::Invalid);
+
+	{
+		bool bValue = false;
+		TestTrue(TEXT("A Bool default parses"), MakeDefinition(TEXT("bSprinting"), EGMCE_SharedVariableType::Bool, TEXT("True")).GetDefaultValue(bValue));
+		TestTrue(TEXT("A Bool default is applied"), bValue);
+
+		FVector Vector;
+		TestTrue(TEXT("A vector default parses"), MakeDefinition(TEXT("Aim"), EGMCE_SharedVariableType::CompressedVector, TEXT("X=1 Y=2 Z=3")).GetDefaultValue(Vector));
+		TestEqual(TEXT("A vector default is applied"), Vector, FVector(1.0, 2.0, 3.0));
+
+		int32 Int = 7;
+		TestTrue(TEXT("An empty default parses"), MakeDefinition(TEXT("Count"), EGMCE_SharedVariableType::Int).GetDefaultValue(Int));
+		TestEqual(TEXT("An empty default is the type's default"), Int, 0);
+	}
+
+	{
+		UGMCE_SharedVariableSchema* Schema = NewObject<UGMCE_SharedVariableSchema>();
+		Schema->Variables = {
+			MakeDefinition(TEXT("Stance"), EGMCE_SharedVariableType::HalfByte, TEXT("3")),
+			MakeDefinition(TEXT("Aim"), EGMCE_SharedVariableType::CompressedVector, TEXT("X=1 Y=2 Z=3")),
+			MakeDefinition(TEXT("Speed"), EGMCE_SharedVariableType::SinglePrecisionFloat),
+			MakeDefinition(TEXT("Attack"), EGMCE_SharedVariableType::AnimMontageReference) };
+
+		TestFalse(TEXT("Defaults aren't parsed until asked for"), Schema->HasParsedDefaultValues());
+		Schema->ParseDefaultValues();
+		TestTrue(TEXT("Defaults are parsed"), Schema->HasParsedDefaultValues());
+		TestEqual(TEXT("A parsed HalfByte default is stored as a byte"), Schema->GetParsedDefaultValue<uint8>(0), static_cast<uint8>(3));
+		TestEqual(TEXT("A parsed vector default is stored as a vector"), Schema->GetParsedDefaultValue<FVector>(1), FVector(1.0, 2.0, 3.0));
+		TestEqual(TEXT("An empty float default is zero"), Schema->GetParsedDefaultValue<float>(2), 0.f);
+		TestNull(TEXT("A montage reference with no default montage is null"), Schema->GetParsedDefaultValue<UAnimMontage*>(3));
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,116 @@
+#include "Components/GMCE_OrganicMovementCmp.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGMCE_StopPivotPredictionTest, "GMCExtended.Trajectory.StopPivotPrediction",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGMCE_StopPivotPredictionTest::RunTest(const FString& Parameters)
+{
+	// The closed forms are checked against stepping trajectory prediction itself. Stopping is checked at the default
+	// sample rate; pivots at a finer one, so that the model's error isn't hidden by the stepping's.
+	constexpr float TimePerSample = 1.f / 30.f;
+	constexpr float PivotTimePerSample = 1.f / 60.f;
+
+	FGMCE_TrajectoryPredictionBuffers Buffers;
+
+	FGMCE_TrajectoryPredictionInput Base;
+	Base.TimePerSample = TimePerSample;
+	Base.MovementMode = EGMC_MovementMode::Grounded;
+	Base.MaxSpeed = 100000.f;
+	Base.MaxTimeStep = 0.05f;
+	Base.MaxGroundedVelocityZ = 0.f;
+
+	const float Speeds[] = { 150.f, 300.f, 600.f, 1000.f };
+	const float Accelerations[] = { 500.f, 1000.f, 2048.f, 4000.f };
+
+	// Stopping: input is held but there's no acceleration, so prediction brakes in sub-steps.
+	for (const float Speed : Speeds)
+	{
+		for (const float BrakingDeceleration : Accelerations)
+		{
+			for (const float Friction : { 0.5f, 1.f, 4.f, 8.f })
+			{
+				const float Deceleration = BrakingDeceleration * Friction;
+
+				FGMCE_TrajectoryPredictionInput Input = Base;
+				Input.InitialVelocity = FVector(Speed, 0.f, 0.f);
+				Input.BrakingDeceleration = BrakingDeceleration;
+				Input.BrakingFriction = Friction;
+				Input.GroundFriction = Friction;
+				Input.bInputPresent = true;
+				Input.NumSamples = FMath::CeilToInt32(Speed / Deceleration / TimePerSample) + 2;
+				UGMCE_OrganicMovementCmp::IntegrateTrajectory(Input, Buffers);
+
+				const int32 Last = Buffers.Num() - 1;
+				const float Stepped = Buffers.OffsetX[Last];
+				const float Predicted = UGMCE_OrganicMovementCmp::PredictGroundedStopLocation(Input.InitialVelocity, BrakingDeceleration, Friction, TimePerSample).X;
+				const float Bound = (Speed * TimePerSample + Deceleration * TimePerSample * TimePerSample) / 2.f;
+
+				TestTrue(FString::Printf(TEXT("Stop from %.0f at %.0f x %.1f: predicted %.2f, stepped %.2f"), Speed, BrakingDeceleration, Friction, Predicted, Stepped),
+					Predicted - Stepped >= -0.5f && Predicted - Stepped <= Bound + 0.5f);
+			}
+		}
+	}
+
+	// Pivoting: accelerating against our velocity, at various angles. The bound is tight enough that the old
+	// constant-deceleration estimate fails it in many of these cases, mostly with friction.
+	for (const float Speed : Speeds)
+	{
+		for (const float Acceleration : Accelerations)
+		{
+			for (const float Friction : { 0.f, 1.f, 4.f, 8.f })
+			{
+				for (const float Angle : { 180.f, 150.f, 120.f, 100.f })
+				{
+					const FVector Direction = FRotator(0.f, Angle, 0.f).Vector();
+
+					FGMCE_TrajectoryPredictionInput Input = Base;
+					Input.TimePerSample = PivotTimePerSample;
+					Input.InitialVelocity = FVector(Speed, 0.f, 0.f);
+					Input.InitialAcceleration = Direction * Acceleration;
+					Input.InputAcceleration = Acceleration;
+					Input.BrakingFriction = Friction;
+					Input.GroundFriction = Friction;
+					Input.bInputPresent = true;
+					Input.NumSamples = FMath::CeilToInt32(Speed / Acceleration / PivotTimePerSample) + 4;
+					UGMCE_OrganicMovementCmp::IntegrateTrajectory(Input, Buffers);
+
+					// Find the sample in which velocity along the acceleration changes sign, and interpolate to it.
+					FVector Stepped = FVector::ZeroVector;
+					bool bReversed = false;
+					FVector PreviousOffset = FVector::ZeroVector;
+					FVector PreviousVelocity = Input.InitialVelocity;
+					for (int32 Idx = 0; Idx < Buffers.Num() && !bReversed; Idx++)
+					{
+						const FVector Offset(Buffers.OffsetX[Idx], Buffers.OffsetY[Idx], Buffers.OffsetZ[Idx]);
+						const FVector Velocity(Buffers.VelocityX[Idx], Buffers.VelocityY[Idx], Buffers.VelocityZ[Idx]);
+						const float Before = PreviousVelocity | Direction;
+						const float After = Velocity | Direction;
+						if (After >= 0.f)
+						{
+							Stepped = PreviousOffset + (Offset - PreviousOffset) * (-Before / (After - Before));
+							bReversed = true;
+						}
+						PreviousOffset = Offset;
+						PreviousVelocity = Velocity;
+					}
+
+					const FVector Predicted = UGMCE_OrganicMovementCmp::PredictGroundedPivotLocation(Input.InitialAcceleration,
+						Input.InitialVelocity, FRotator::ZeroRotator, Friction, PivotTimePerSample, 90.f);
+					const float Bound = 0.05f * Predicted.Size() + Speed * PivotTimePerSample;
+
+					TestTrue(FString::Printf(TEXT("Pivot from %.0f at %.0f, %.0f degrees, friction %.1f reverses"), Speed, Acceleration, Angle, Friction), bReversed);
+					TestTrue(FString::Printf(TEXT("Pivot from %.0f at %.0f, %.0f degrees, friction %.1f: predicted %s, stepped %s"),
+						Speed, Acceleration, Angle, Friction, *Predicted.ToString(), *Stepped.ToString()),
+						FVector::Dist(Predicted, Stepped) <= Bound + 0.5f);
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+#endif
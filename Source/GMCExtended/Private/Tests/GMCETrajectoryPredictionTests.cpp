@@ -0,0 +1,92 @@
+#include "Support/GMCETrajectoryPrediction.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGMCE_TrajectoryOriginSpaceTest, "GMCExtended.Trajectory.TransformToOriginSpace",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGMCE_TrajectoryOriginSpaceTest::RunTest(const FString& Parameters)
+{
+	// Not a multiple of the SIMD width, so the last batch is partly padding.
+	constexpr int32 NumSamples = 7;
+	const FTransform Origin(FRotator(10.f, 135.f, -20.f), FVector(1200.f, -340.f, 55.f), FVector(1.5f, 0.5f, 2.f));
+
+	FGMCE_TrajectoryPredictionBuffers Buffers;
+	Buffers.Reset(NumSamples);
+
+	TArray<FVector> Offsets;
+	TArray<FVector> Velocities;
+	for (int32 Idx = 0; Idx < NumSamples; Idx++)
+	{
+		Offsets.Emplace(37.f * Idx - 80.f, 11.f * Idx * Idx, 5.f - 3.f * Idx);
+		Velocities.Emplace(400.f - 90.f * Idx, 25.f * Idx, -60.f + 15.f * Idx);
+		Buffers.SetSample(Idx, Offsets[Idx], Velocities[Idx], FVector::ZeroVector, 0.f, 0.f, 0.f, false);
+	}
+
+	Buffers.TransformToOriginSpace(Origin);
+
+	for (int32 Idx = 0; Idx < NumSamples; Idx++)
+	{
+		const FVector ExpectedOffset = FTransform(Origin.GetLocation() + Offsets[Idx]).GetRelativeTransform(Origin).GetTranslation();
+		const FVector ExpectedVelocity = Origin.InverseTransformVectorNoScale(Velocities[Idx]);
+
+		const FVector Offset(Buffers.RelativeOffsetX[Idx], Buffers.RelativeOffsetY[Idx], Buffers.RelativeOffsetZ[Idx]);
+		const FVector Velocity(Buffers.RelativeVelocityX[Idx], Buffers.RelativeVelocityY[Idx], Buffers.RelativeVelocityZ[Idx]);
+
+		TestTrue(FString::Printf(TEXT("Sample %d offset %s matches GetRelativeTransform %s"), Idx, *Offset.ToString(), *ExpectedOffset.ToString()),
+			Offset.Equals(ExpectedOffset, 0.01f));
+		TestTrue(FString::Printf(TEXT("Sample %d velocity %s matches InverseTransformVectorNoScale %s"), Idx, *Velocity.ToString(), *ExpectedVelocity.ToString()),
+			Velocity.Equals(ExpectedVelocity, 0.01f));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGMCE_TrajectoryAppendSamplesTest, "GMCExtended.Trajectory.AppendSamples",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGMCE_TrajectoryAppendSamplesTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumSamples = 6;
+
+	FGMCE_TrajectoryPredictionInput Input;
+	Input.Origin = FTransform(FRotator(4.f, 30.f, -3.f), FVector(100.f, 200.f, 30.f));
+	Input.MeshOffsetRotation = FRotator(2.f, -90.f, 1.f);
+	Input.ControllerRotation = FRotator(-15.f, 0.f, 0.f);
+	Input.TimePerSample = 0.1f;
+
+	FGMCE_TrajectoryPredictionBuffers Buffers;
+	Buffers.Reset(NumSamples);
+	for (int32 Idx = 0; Idx < NumSamples; Idx++)
+	{
+		// Yaw deliberately winds past 180 degrees.
+		Buffers.SetSample(Idx, FVector(50.f * Idx, 0.f, 0.f), FVector(500.f, 0.f, 0.f), FVector::ZeroVector,
+			30.f + 45.f * Idx, 10.f * Idx, -90.f + 5.f * Idx, false);
+	}
+	Buffers.TransformToOriginSpace(Input.Origin);
+
+	TArray<FGMCE_MovementSample> Samples;
+	Buffers.AppendSamples(Input, Samples);
+
+	const FRotator OriginRotation = Input.Origin.GetRotation().Rotator();
+	for (int32 Idx = 0; Idx < NumSamples; Idx++)
+	{
+		// Built the long way round, through rotator/quaternion conversions.
+		const FQuat ExpectedRotation = FRotator(OriginRotation.Pitch, Buffers.Yaw[Idx], OriginRotation.Roll).Quaternion();
+		const FQuat ExpectedActorRotation = (ExpectedRotation.Rotator() - Input.MeshOffsetRotation).Quaternion();
+		const FQuat ExpectedMeshRotation = FRotator(Input.MeshOffsetRotation.Pitch, Buffers.MeshOffsetYaw[Idx], Input.MeshOffsetRotation.Roll).Quaternion();
+		const FQuat ExpectedRelativeRotation = Input.Origin.GetRotation().Inverse() * ExpectedRotation;
+
+		const FGMCE_MovementSample& Sample = Samples[Idx];
+		TestTrue(FString::Printf(TEXT("Sample %d rotation"), Idx), Sample.WorldTransform.GetRotation().Equals(ExpectedRotation, 1.e-4f));
+		TestTrue(FString::Printf(TEXT("Sample %d actor rotation"), Idx), Sample.ActorWorldTransform.GetRotation().Equals(ExpectedActorRotation, 1.e-4f));
+		TestTrue(FString::Printf(TEXT("Sample %d actor rotator"), Idx), Sample.ActorWorldRotation.Quaternion().Equals(ExpectedActorRotation, 1.e-4f));
+		TestTrue(FString::Printf(TEXT("Sample %d mesh rotation"), Idx), Sample.MeshComponentRelativeRotation.Equals(ExpectedMeshRotation, 1.e-4f));
+		TestTrue(FString::Printf(TEXT("Sample %d relative rotation"), Idx), Sample.RelativeTransform.GetRotation().Equals(ExpectedRelativeRotation, 1.e-4f));
+	}
+
+	return true;
+}
+
+#endif
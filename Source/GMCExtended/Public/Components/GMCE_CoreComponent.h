@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "GMCOrganicMovementComponent.h"
+#include "Misc/TVariant.h"
 #include "GMCE_CoreComponent.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnSharedBoolChange, FName, VariableName, bool, NewValue, bool, OldValue);
@@ -22,8 +23,139 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnSharedAnimMontageReferenceChan
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnSharedNameChange, FName, VariableName, FName, NewValue, FName, OldValue);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnSharedGameplayTagChange, FName, VariableName, FGameplayTag, NewValue, FGameplayTag, OldValue);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnSharedGameplayTagContainerChange, FName, VariableName, FGameplayTagContainer, NewValue, FGameplayTagContainer, OldValue);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnSharedInstancedStructChange, FName, VariableName, FName, FieldName, const FInstancedStruct&, NewValue, const FInstancedStruct&, OldValue);
 
 class UGMCE_CoreComponent;
+class UGMCE_SharedVariableSchema;
+
+UENUM(BlueprintType)
+enum class EGMCE_SharedVariableType : uint8
+{
+	Bool,
+	HalfByte,
+	Byte,
+	Int,
+	SinglePrecisionFloat,
+	CompressedSinglePrecisionFloat,
+	DoublePrecisionFloat,
+	CompressedDoublePrecisionFloat,
+	TruncatedDoublePrecisionFloat,
+	CompressedVector2D,
+	CompressedVector,
+	CompressedRotator,
+	ActorReference,
+	ActorComponentReference,
+	AnimMontageReference,
+	Name,
+	GameplayTag,
+	GameplayTagContainer,
+	InstancedStruct,
+	Invalid UMETA(Hidden)
+};
+
+/// A shared variable resolved to its storage slot on a specific core component. Resolve it once (typically right
+/// after making the variable, or at bind time) via UGMCE_CoreComponent::FindSharedVariableHandle, then use the
+/// handle overloads of GetShared/SetShared to read and write the value without any name lookup. A handle is only
+/// meaningful on the component which issued it.
+struct FGMCE_SharedVariableHandle
+{
+	EGMCE_SharedVariableType Type { EGMCE_SharedVariableType::Invalid };
+	int32 Slot { INDEX_NONE };
+
+	bool IsValid() const { return Type != EGMCE_SharedVariableType::Invalid && Slot != INDEX_NONE; }
+
+	bool operator==(const FGMCE_SharedVariableHandle& Other) const { return Type == Other.Type && Slot == Other.Slot; }
+};
+
+/// Any value a shared variable can hold; the active type matches the C++ type of the variable's store.
+using FGMCE_SharedVariableValue = TVariant<bool, uint8, int32, float, double, FVector2D, FVector, FRotator, AActor*,
+	UActorComponent*, UAnimMontage*, FName, FGameplayTag, FGameplayTagContainer, FInstancedStruct>;
+
+/// A single shared variable change, as reported by UGMCE_CoreComponent::OnSharedVariablesChanged.
+struct FGMCE_SharedVariableChange
+{
+	FGMCE_SharedVariableHandle Handle;
+	FName VariableName;
+
+	/// For struct-typed variables, the top-level field which changed (one entry is reported per field), or
+	/// NAME_None if the struct type itself changed. Always NAME_None for other types.
+	FName FieldName;
+
+	FGMCE_SharedVariableValue OldValue;
+	FGMCE_SharedVariableValue NewValue;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnSharedVariablesChanged, const TArray<FGMCE_SharedVariableChange>& /* Changes */);
+
+/// One shared variable's replication footprint, as reported by UGMCE_CoreComponent::GetSharedVariableReport.
+USTRUCT(BlueprintType)
+struct GMCEXTENDED_API FGMCE_SharedVariableReportEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="Shared Variables")
+	FName VariableName { NAME_None };
+
+	UPROPERTY(BlueprintReadOnly, Category="Shared Variables")
+	EGMCE_SharedVariableType Type { EGMCE_SharedVariableType::Invalid };
+
+	/// The GMC bind index, or -1 if the variable has not been bound or failed to bind.
+	UPROPERTY(BlueprintReadOnly, Category="Shared Variables")
+	int32 BindIndex { -1 };
+
+	/// False until the variable is bound, or if binding failed (in which case it is not replicated at all).
+	UPROPERTY(BlueprintReadOnly, Category="Shared Variables")
+	bool bBound { false };
+
+	/// True if this is a Bool packed into a shared integer word; BindIndex is then the word's.
+	UPROPERTY(BlueprintReadOnly, Category="Shared Variables")
+	bool bPacked { false };
+
+	/// True if this is a typed member variable registered with BindSharedVariable, rather than one made by name.
+	UPROPERTY(BlueprintReadOnly, Category="Shared Variables")
+	bool bTyped { false };
+
+	UPROPERTY(BlueprintReadOnly, Category="Shared Variables")
+	EGMC_PredictionMode PredictionRule { EGMC_PredictionMode::ServerAuth_Output_ClientValidated };
+
+	UPROPERTY(BlueprintReadOnly, Category="Shared Variables")
+	EGMC_SimulationMode SimulationRule { EGMC_SimulationMode::Periodic_Output };
+
+	/// A rough estimate of the bits needed to serialize the current value once. Variable-size types (tag
+	/// containers, instanced structs) are estimated from their current contents.
+	UPROPERTY(BlueprintReadOnly, Category="Shared Variables")
+	int32 EstimatedBits { 0 };
+};
+
+/// A copy of every shared variable value on a core component, taken with UGMCE_CoreComponent::CaptureSharedVariables.
+/// Typed member variables (TGMCE_TypedSharedVariable) are not included; they live on the components which declare
+/// them, and are captured by those components if at all. Buffers are reset rather than freed between captures, so
+/// reusing one snapshot does not allocate once it has grown to size. Values are raw copies (including object
+/// pointers and names), so a snapshot is only meaningful within the running process, restored onto a component
+/// with the same set of shared variables.
+struct FGMCE_SharedVariableSnapshot
+{
+	/// Trivially copyable values, packed back to back by type and then by slot.
+	TArray<uint8> Data;
+
+	/// Values which own memory of their own, by slot.
+	TArray<FGameplayTagContainer> GameplayTagContainers;
+	TArray<FInstancedStruct> InstancedStructs;
+
+	/// Variables of each type at capture time; restoring requires the same layout.
+	int32 Counts[static_cast<int32>(EGMCE_SharedVariableType::Invalid)] { };
+
+	/// Clear the packed data and counts. Values which own memory are left alone; capture resizes them to fit and
+	/// assigns into them by slot, so that their storage is reused from one capture to the next.
+	void Reset()
+	{
+		Data.Reset();
+		FMemory::Memzero(Counts);
+	}
+};
+
+template<typename T>
+struct TGMCE_SharedVariableStore;
 
 template<typename T>
 struct TGMCE_SharedVariable
@@ -33,22 +165,22 @@ public:
 	FName GetName() const { return VariableName; }
 
 	/// Get the current value of this shared variable.
-	T GetValue() const { return CurrentValue; }
+	const T& GetValue() const { return CurrentValue; }
 
 	/// Set a current value for this shared variable.
 	void SetValue(T NewValue) { CurrentValue = NewValue; };
 
 	/// Obtain the GMC bind index for this variable.
 	int32 GetBindIndex() const { return BindIndex; }
-	
-	bool operator==(const TGMCE_SharedVariable<T>& Other ) const { return GetName() == VariableName; }
+
+	bool operator==(const TGMCE_SharedVariable<T>& Other ) const { return Other.GetName() == VariableName; }
 	T operator=(const T& NewValue) { CurrentValue = NewValue; return NewValue; }
-	TGMCE_SharedVariable<T> operator=(const TGMCE_SharedVariable<T>& Other)
+	TGMCE_SharedVariable<T>& operator=(const TGMCE_SharedVariable<T>& Other)
 	{
 		CurrentValue = Other.CurrentValue;
-		return this;
+		return *this;
 	}
-	
+
 	// ReSharper disable once CppNonExplicitConversionOperator
 	operator T() const { return CurrentValue; }
 
@@ -56,6 +188,7 @@ public:
 	{
 		VariableName = Name;
 		CurrentValue = Value;
+		OldValue = Value;
 		BindIndex = -1;
 		PredictionRule = EGMC_PredictionMode::ServerAuth_Output_ClientValidated;
 		CombineRule = EGMC_CombineMode::AlwaysCombine;
@@ -64,6 +197,20 @@ public:
 	}
 
 	bool WasUpdated() const { return CurrentValue != OldValue; }
+
+	/// Accept the current value as seen, so that WasUpdated() is false until the value next changes.
+	void AcknowledgeUpdate() { OldValue = CurrentValue; }
+
+	const T& GetOldValue() const { return OldValue; }
+
+	void SetReplicationRules(EGMC_PredictionMode Prediction, EGMC_CombineMode Combine, EGMC_SimulationMode Simulation,
+	                         EGMC_InterpolationFunction Interpolation)
+	{
+		PredictionRule = Prediction;
+		CombineRule = Combine;
+		SimulationRule = Simulation;
+		InterpolationRule = Interpolation;
+	}
 	
 private:
 	/// The name of this shared attribute.
@@ -85,11 +232,226 @@ private:
 	EGMC_InterpolationFunction InterpolationRule;
 
 	friend UGMCE_CoreComponent;
-	
+	friend struct TGMCE_SharedVariableStore<T>;
+
+};
+
+/// Which shared variables GMC may have written directly, bypassing SetValue, since change detection last ran.
+enum class EGMCE_SharedVariableGather : uint8
+{
+	/// None; only variables SetValue has flagged as dirty can have changed.
+	DirtyOnly,
+
+	/// Variables GMC replicates to simulated proxies.
+	Simulated,
+
+	/// Variables whose values the server takes from the owning client: every prediction mode other than
+	/// ServerAuth_Output_ClientValidated.
+	ClientSupplied,
+
+	/// Any variable (server state adoption and replays).
+	All
+};
+
+/// Dense, slot-indexed storage for every shared variable of a single type. Variables are never removed or
+/// reordered once made, so a slot stays valid (and the reference GMC holds to a bound value stays stable)
+/// for the lifetime of the owning component. Variables which fail to bind are retired rather than removed.
+template<typename T>
+struct TGMCE_SharedVariableStore
+{
+	/// Every variable of this type, indexed by slot.
+	TArray<TGMCE_SharedVariable<T>> Variables;
+
+	/// Name-to-slot lookup; only used by the name-based API.
+	TMap<FName, int32> Slots;
+
+	/// One bit per slot, set whenever that variable's value may have changed since the last notification pass.
+	TBitArray<> DirtySlots;
+
+	/// One bit per slot, cleared when a variable has been retired.
+	TBitArray<> LiveSlots;
+
+	/// Set when every variable was added from a schema, in schema order; binding then keeps slot order rather
+	/// than sorting by name.
+	bool bDeclarationOrdered { false };
+
+	int32 Num() const { return Variables.Num(); }
+
+	bool IsValidSlot(int32 Slot) const { return LiveSlots.IsValidIndex(Slot) && LiveSlots[Slot]; }
+
+	int32 FindSlot(const FName& Name) const
+	{
+		const int32* Slot = Slots.Find(Name);
+		return Slot ? *Slot : INDEX_NONE;
+	}
+
+	TGMCE_SharedVariable<T>* Find(const FName& Name)
+	{
+		const int32 Slot = FindSlot(Name);
+		return Slot != INDEX_NONE ? &Variables[Slot] : nullptr;
+	}
+
+	void Reserve(int32 Count)
+	{
+		Variables.Reserve(Count);
+		Slots.Reserve(Count);
+		DirtySlots.Reserve(Count);
+		LiveSlots.Reserve(Count);
+	}
+
+	TGMCE_SharedVariable<T>& Add(const FName& Name, const T& DefaultValue)
+	{
+		bDeclarationOrdered = false;
+		const int32 Slot = Variables.Emplace(Name, DefaultValue);
+		Slots.Add(Name, Slot);
+		DirtySlots.Add(false);
+		LiveSlots.Add(true);
+		return Variables[Slot];
+	}
+
+	void SetValue(int32 Slot, const T& NewValue)
+	{
+		TGMCE_SharedVariable<T>& Variable = Variables[Slot];
+		if (Variable.CurrentValue != NewValue)
+		{
+			Variable.CurrentValue = NewValue;
+			DirtySlots[Slot] = true;
+		}
+	}
+
+	/// Remove a variable from name lookup and change detection, leaving its slot in place.
+	void Retire(int32 Slot)
+	{
+		Slots.Remove(Variables[Slot].VariableName);
+		LiveSlots[Slot] = false;
+		DirtySlots[Slot] = false;
+	}
+
+	/// Slots in the order they should be bound to GMC. Binding order must match between server and client,
+	/// so this is sorted by name rather than by slot (which depends on registration order), unless the slots
+	/// all came from a schema.
+	TArray<int32> GetBindOrder() const
+	{
+		TArray<int32> Result;
+		Result.Reserve(Variables.Num());
+		for (TConstSetBitIterator<> It(LiveSlots); It; ++It)
+		{
+			Result.Add(It.GetIndex());
+		}
+		if (bDeclarationOrdered) return Result;
+
+		Result.Sort([this](const int32 A, const int32 B){ return Variables[A].VariableName.LexicalLess(Variables[B].VariableName); });
+		return Result;
+	}
+
+	/// GMC writes some bound values directly (replays, server state adoption, client-supplied values on the server,
+	/// simulation), bypassing SetValue; flag any live slot of the given kind whose value no longer matches what we
+	/// last notified about. Anything else can only have changed through SetValue, which already marked it dirty.
+	/// Returns true if anything is dirty.
+	bool GatherChanges(EGMCE_SharedVariableGather Gather)
+	{
+		const int32 Count = Variables.Num();
+		if (Count == 0) return false;
+		if (Gather == EGMCE_SharedVariableGather::DirtyOnly) return DirtySlots.Contains(true);
+
+		for (int32 Slot = 0; Slot < Count; Slot++)
+		{
+			const TGMCE_SharedVariable<T>& Variable = Variables[Slot];
+			if (Gather == EGMCE_SharedVariableGather::Simulated && Variable.SimulationRule == EGMC_SimulationMode::None) continue;
+			if (Gather == EGMCE_SharedVariableGather::ClientSupplied && Variable.PredictionRule == EGMC_PredictionMode::ServerAuth_Output_ClientValidated) continue;
+
+			if (LiveSlots[Slot] && Variable.WasUpdated())
+			{
+				DirtySlots[Slot] = true;
+			}
+		}
+
+		return DirtySlots.Contains(true);
+	}
+};
+
+/// Maps each shared variable type onto the C++ type it is stored as.
+template<EGMCE_SharedVariableType Type>
+struct TGMCE_SharedVariableTraits;
+
+#define GMCE_SHARED_VARIABLE_TRAITS(TypeName, Type) \
+	template<> struct TGMCE_SharedVariableTraits<EGMCE_SharedVariableType::TypeName> { using ValueType = Type; };
+
+GMCE_SHARED_VARIABLE_TRAITS(Bool, bool)
+GMCE_SHARED_VARIABLE_TRAITS(HalfByte, uint8)
+GMCE_SHARED_VARIABLE_TRAITS(Byte, uint8)
+GMCE_SHARED_VARIABLE_TRAITS(Int, int32)
+GMCE_SHARED_VARIABLE_TRAITS(SinglePrecisionFloat, float)
+GMCE_SHARED_VARIABLE_TRAITS(CompressedSinglePrecisionFloat, float)
+GMCE_SHARED_VARIABLE_TRAITS(DoublePrecisionFloat, double)
+GMCE_SHARED_VARIABLE_TRAITS(CompressedDoublePrecisionFloat, double)
+GMCE_SHARED_VARIABLE_TRAITS(TruncatedDoublePrecisionFloat, double)
+GMCE_SHARED_VARIABLE_TRAITS(CompressedVector2D, FVector2D)
+GMCE_SHARED_VARIABLE_TRAITS(CompressedVector, FVector)
+GMCE_SHARED_VARIABLE_TRAITS(CompressedRotator, FRotator)
+GMCE_SHARED_VARIABLE_TRAITS(ActorReference, AActor*)
+GMCE_SHARED_VARIABLE_TRAITS(ActorComponentReference, UActorComponent*)
+GMCE_SHARED_VARIABLE_TRAITS(AnimMontageReference, UAnimMontage*)
+GMCE_SHARED_VARIABLE_TRAITS(Name, FName)
+GMCE_SHARED_VARIABLE_TRAITS(GameplayTag, FGameplayTag)
+GMCE_SHARED_VARIABLE_TRAITS(GameplayTagContainer, FGameplayTagContainer)
+GMCE_SHARED_VARIABLE_TRAITS(InstancedStruct, FInstancedStruct)
+
+/// A shared variable declared directly as a member of a native component, rather than made by name on the core
+/// component. Bind it from OnBindSharedVariables with UGMCE_CoreComponent::BindSharedVariable; the shared variable
+/// type is part of the C++ type, so binding a variable with the wrong kind of value fails to compile.
+///
+/// BindSharedVariable only registers the variable. Once every component has registered its variables, they are
+/// bound sorted by type and then name, like name-based variables, so that server and client agree on the bind
+/// order regardless of component order. Names must therefore be unique per type, and the bind index is only valid
+/// after BindReplicationData.
+///
+/// Typed variables are not part of the core component's name lookup or change notifications; the owning component
+/// reads and writes the value directly and can use WasUpdated()/AcknowledgeUpdate() to detect changes itself.
+template<EGMCE_SharedVariableType Type>
+struct TGMCE_TypedSharedVariable : public TGMCE_SharedVariable<typename TGMCE_SharedVariableTraits<Type>::ValueType>
+{
+	using ValueType = typename TGMCE_SharedVariableTraits<Type>::ValueType;
+	using Super = TGMCE_SharedVariable<ValueType>;
+	using Super::operator=;
+
+	explicit TGMCE_TypedSharedVariable(const FName& Name, const ValueType& DefaultValue = ValueType(),
+		EGMC_PredictionMode PredictionRule = EGMC_PredictionMode::ServerAuth_Output_ClientValidated,
+		EGMC_CombineMode CombineRule = EGMC_CombineMode::AlwaysCombine,
+		EGMC_SimulationMode SimulationRule = EGMC_SimulationMode::Periodic_Output,
+		EGMC_InterpolationFunction InterpolationRule = EGMC_InterpolationFunction::NearestNeighbour)
+		: Super(Name, DefaultValue)
+	{
+		Super::SetReplicationRules(PredictionRule, CombineRule, SimulationRule, InterpolationRule);
+	}
+};
+
+/// Up to 32 Bool shared variables with identical replication rules, bound to GMC as a single integer.
+struct FGMCE_PackedSharedBools
+{
+	/// The bound word; bit N holds the variable at PackedBoolSlots[Word * 32 + N].
+	int32 Bits { 0 };
+
+	/// Bits as of the last unpack, so changes written by GMC can be found with a single XOR.
+	int32 LastBits { 0 };
+
+	int32 BindIndex { -1 };
+};
+
+/// A typed shared variable registered through BindSharedVariable, waiting for every component to register theirs.
+struct FGMCE_PendingTypedSharedVariable
+{
+	EGMCE_SharedVariableType Type { EGMCE_SharedVariableType::Invalid };
+	FName VariableName { NAME_None };
+
+	/// The registered member, only used to spot a variable being registered twice.
+	const void* Variable { nullptr };
+
+	TFunction<void()> Bind;
 };
 
 #define SHARED_VARIABLES(TypeName, Type) \
-	TMap<FName,TGMCE_SharedVariable<Type>> SharedVariables_##TypeName;
+	TGMCE_SharedVariableStore<Type> SharedVariables_##TypeName;
 
 UCLASS(ClassGroup=(GMCExtended), meta=(BlueprintSpawnableComponent, DisplayName="GMCExtended Core Component"))
 class GMCEXTENDED_API UGMCE_CoreComponent : public UGMC_OrganicMovementCmp
@@ -114,6 +476,11 @@ public:
 
 	virtual void CheckForSharedVariableUpdates();
 
+	/// Resolve a shared variable name to a handle for O(1) access through the handle overloads of GetShared and
+	/// SetShared. Returns an invalid handle if no variable of that type and name has been made (or if it failed
+	/// to bind).
+	FGMCE_SharedVariableHandle FindSharedVariableHandle(EGMCE_SharedVariableType Type, const FName& VariableName) const;
+
 	// SharedVars - Bool
 #pragma region
 	UFUNCTION(BlueprintCallable, Category="Shared Variables|Bool", meta=(AutoCreateRefTerm="VariableName"))
@@ -125,12 +492,15 @@ public:
 	void GetSharedBool(const FName& VariableName, UPARAM(DisplayName="Value") bool& OutValue,
 	                UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool GetSharedBool(const FName& VariableName, bool& OutValue);
+	bool GetSharedBool(const FGMCE_SharedVariableHandle& Handle, bool& OutValue) const;
 
 	UFUNCTION(BlueprintCallable, Category="Shared Variables|Bool", meta=(AutoCreateRefTerm="VariableName"))
 	void SetSharedBool(const FName& VariableName, bool NewValue, UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool SetSharedBool(const FName& VariableName, bool NewValue);
+	bool SetSharedBool(const FGMCE_SharedVariableHandle& Handle, bool NewValue);
 
 	void BindSharedBoolVariables();
+	bool BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::Bool>& Variable);
 	
 #pragma endregion
 
@@ -145,12 +515,15 @@ public:
 	void GetSharedHalfByte(const FName& VariableName, UPARAM(DisplayName="Value") uint8& OutValue,
 	                UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool GetSharedHalfByte(const FName& VariableName, uint8& OutValue);
+	bool GetSharedHalfByte(const FGMCE_SharedVariableHandle& Handle, uint8& OutValue) const;
 
 	UFUNCTION(BlueprintCallable, Category="Shared Variables|HalfByte", meta=(AutoCreateRefTerm="VariableName"))
 	void SetSharedHalfByte(const FName& VariableName, uint8 NewValue, UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool SetSharedHalfByte(const FName& VariableName, uint8 NewValue);
+	bool SetSharedHalfByte(const FGMCE_SharedVariableHandle& Handle, uint8 NewValue);
 
 	void BindSharedHalfByteVariables();
+	bool BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::HalfByte>& Variable);
 #pragma endregion
 
 	// SharedVars - Byte
@@ -164,12 +537,15 @@ public:
 	void GetSharedByte(const FName& VariableName, UPARAM(DisplayName="Value") uint8& OutValue,
 	                UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool GetSharedByte(const FName& VariableName, uint8& OutValue);
+	bool GetSharedByte(const FGMCE_SharedVariableHandle& Handle, uint8& OutValue) const;
 
 	UFUNCTION(BlueprintCallable, Category="Shared Variables|Byte", meta=(AutoCreateRefTerm="VariableName"))
 	void SetSharedByte(const FName& VariableName, uint8 NewValue, UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool SetSharedByte(const FName& VariableName, uint8 NewValue);
+	bool SetSharedByte(const FGMCE_SharedVariableHandle& Handle, uint8 NewValue);
 
 	void BindSharedByteVariables();
+	bool BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::Byte>& Variable);
 #pragma endregion
 
 	// SharedVars - Int
@@ -183,12 +559,15 @@ public:
 	void GetSharedInt(const FName& VariableName, UPARAM(DisplayName="Value") int32& OutValue,
 	                UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool GetSharedInt(const FName& VariableName, int32& OutValue);
+	bool GetSharedInt(const FGMCE_SharedVariableHandle& Handle, int32& OutValue) const;
 
 	UFUNCTION(BlueprintCallable, Category="Shared Variables|Int", meta=(AutoCreateRefTerm="VariableName"))
 	void SetSharedInt(const FName& VariableName, int32 NewValue, UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool SetSharedInt(const FName& VariableName, int32 NewValue);
+	bool SetSharedInt(const FGMCE_SharedVariableHandle& Handle, int32 NewValue);
 
 	void BindSharedIntVariables();
+	bool BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::Int>& Variable);
 #pragma endregion
 
 	// SharedVars - SinglePrecisionFloat
@@ -202,12 +581,15 @@ public:
 	void GetSharedSinglePrecisionFloat(const FName& VariableName, UPARAM(DisplayName="Value") float& OutValue,
 	                UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool GetSharedSinglePrecisionFloat(const FName& VariableName, float& OutValue);
+	bool GetSharedSinglePrecisionFloat(const FGMCE_SharedVariableHandle& Handle, float& OutValue) const;
 
 	UFUNCTION(BlueprintCallable, Category="Shared Variables|SinglePrecisionFloat", meta=(AutoCreateRefTerm="VariableName"))
 	void SetSharedSinglePrecisionFloat(const FName& VariableName, float NewValue, UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool SetSharedSinglePrecisionFloat(const FName& VariableName, float NewValue);
+	bool SetSharedSinglePrecisionFloat(const FGMCE_SharedVariableHandle& Handle, float NewValue);
 
 	void BindSharedSinglePrecisionFloatVariables();
+	bool BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::SinglePrecisionFloat>& Variable);
 #pragma endregion
 
 	// SharedVars - CompressedSinglePrecisionFloat
@@ -221,12 +603,15 @@ public:
 	void GetSharedCompressedSinglePrecisionFloat(const FName& VariableName, UPARAM(DisplayName="Value") float& OutValue,
 	                UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool GetSharedCompressedSinglePrecisionFloat(const FName& VariableName, float& OutValue);
+	bool GetSharedCompressedSinglePrecisionFloat(const FGMCE_SharedVariableHandle& Handle, float& OutValue) const;
 
 	UFUNCTION(BlueprintCallable, Category="Shared Variables|CompressedSinglePrecisionFloat", meta=(AutoCreateRefTerm="VariableName"))
 	void SetSharedCompressedSinglePrecisionFloat(const FName& VariableName, float NewValue, UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool SetSharedCompressedSinglePrecisionFloat(const FName& VariableName, float NewValue);
+	bool SetSharedCompressedSinglePrecisionFloat(const FGMCE_SharedVariableHandle& Handle, float NewValue);
 
 	void BindSharedCompressedSinglePrecisionFloatVariables();
+	bool BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::CompressedSinglePrecisionFloat>& Variable);
 #pragma endregion
 
 	// SharedVars - DoublePrecisionFloat
@@ -240,12 +625,15 @@ public:
 	void GetSharedDoublePrecisionFloat(const FName& VariableName, UPARAM(DisplayName="Value") double& OutValue,
 	                UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool GetSharedDoublePrecisionFloat(const FName& VariableName, double& OutValue);
+	bool GetSharedDoublePrecisionFloat(const FGMCE_SharedVariableHandle& Handle, double& OutValue) const;
 
 	UFUNCTION(BlueprintCallable, Category="Shared Variables|DoublePrecisionFloat", meta=(AutoCreateRefTerm="VariableName"))
 	void SetSharedDoublePrecisionFloat(const FName& VariableName, double NewValue, UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool SetSharedDoublePrecisionFloat(const FName& VariableName, double NewValue);
+	bool SetSharedDoublePrecisionFloat(const FGMCE_SharedVariableHandle& Handle, double NewValue);
 
 	void BindSharedDoublePrecisionFloatVariables();
+	bool BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::DoublePrecisionFloat>& Variable);
 #pragma endregion
 
 	// SharedVars - CompressedDoublePrecisionFloat
@@ -259,12 +647,15 @@ public:
 	void GetSharedCompressedDoublePrecisionFloat(const FName& VariableName, UPARAM(DisplayName="Value") double& OutValue,
 	                UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool GetSharedCompressedDoublePrecisionFloat(const FName& VariableName, double& OutValue);
+	bool GetSharedCompressedDoublePrecisionFloat(const FGMCE_SharedVariableHandle& Handle, double& OutValue) const;
 
 	UFUNCTION(BlueprintCallable, Category="Shared Variables|CompressedDoublePrecisionFloat", meta=(AutoCreateRefTerm="VariableName"))
 	void SetSharedCompressedDoublePrecisionFloat(const FName& VariableName, double NewValue, UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool SetSharedCompressedDoublePrecisionFloat(const FName& VariableName, double NewValue);
+	bool SetSharedCompressedDoublePrecisionFloat(const FGMCE_SharedVariableHandle& Handle, double NewValue);
 
 	void BindSharedCompressedDoublePrecisionFloatVariables();
+	bool BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::CompressedDoublePrecisionFloat>& Variable);
 #pragma endregion
 
 	// SharedVars - TruncatedDoublePrecisionFloat
@@ -278,12 +669,15 @@ public:
 	void GetSharedTruncatedDoublePrecisionFloat(const FName& VariableName, UPARAM(DisplayName="Value") double& OutValue,
 	                UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool GetSharedTruncatedDoublePrecisionFloat(const FName& VariableName, double& OutValue);
+	bool GetSharedTruncatedDoublePrecisionFloat(const FGMCE_SharedVariableHandle& Handle, double& OutValue) const;
 
 	UFUNCTION(BlueprintCallable, Category="Shared Variables|TruncatedDoublePrecisionFloat", meta=(AutoCreateRefTerm="VariableName"))
 	void SetSharedTruncatedDoublePrecisionFloat(const FName& VariableName, double NewValue, UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool SetSharedTruncatedDoublePrecisionFloat(const FName& VariableName, double NewValue);
+	bool SetSharedTruncatedDoublePrecisionFloat(const FGMCE_SharedVariableHandle& Handle, double NewValue);
 
 	void BindSharedTruncatedDoublePrecisionFloatVariables();
+	bool BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::TruncatedDoublePrecisionFloat>& Variable);
 #pragma endregion
 
 	// SharedVars - CompressedVector2D
@@ -297,12 +691,15 @@ public:
 	void GetSharedCompressedVector2D(const FName& VariableName, UPARAM(DisplayName="Value") FVector2D& OutValue,
 	                UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool GetSharedCompressedVector2D(const FName& VariableName, FVector2D& OutValue);
+	bool GetSharedCompressedVector2D(const FGMCE_SharedVariableHandle& Handle, FVector2D& OutValue) const;
 
 	UFUNCTION(BlueprintCallable, Category="Shared Variables|CompressedVector2D", meta=(AutoCreateRefTerm="VariableName"))
 	void SetSharedCompressedVector2D(const FName& VariableName, FVector2D NewValue, UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool SetSharedCompressedVector2D(const FName& VariableName, FVector2D NewValue);
+	bool SetSharedCompressedVector2D(const FGMCE_SharedVariableHandle& Handle, FVector2D NewValue);
 
 	void BindSharedCompressedVector2DVariables();
+	bool BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::CompressedVector2D>& Variable);
 #pragma endregion
 
 	// SharedVars - CompressedVector
@@ -316,12 +713,15 @@ public:
 	void GetSharedCompressedVector(const FName& VariableName, UPARAM(DisplayName="Value") FVector& OutValue,
 	                UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool GetSharedCompressedVector(const FName& VariableName, FVector& OutValue);
+	bool GetSharedCompressedVector(const FGMCE_SharedVariableHandle& Handle, FVector& OutValue) const;
 
 	UFUNCTION(BlueprintCallable, Category="Shared Variables|CompressedVector", meta=(AutoCreateRefTerm="VariableName"))
 	void SetSharedCompressedVector(const FName& VariableName, FVector NewValue, UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool SetSharedCompressedVector(const FName& VariableName, FVector NewValue);
+	bool SetSharedCompressedVector(const FGMCE_SharedVariableHandle& Handle, FVector NewValue);
 
 	void BindSharedCompressedVectorVariables();
+	bool BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::CompressedVector>& Variable);
 #pragma endregion
 
 	// SharedVars - CompressedRotator
@@ -335,12 +735,15 @@ public:
 	void GetSharedCompressedRotator(const FName& VariableName, UPARAM(DisplayName="Value") FRotator& OutValue,
 	                UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool GetSharedCompressedRotator(const FName& VariableName, FRotator& OutValue);
+	bool GetSharedCompressedRotator(const FGMCE_SharedVariableHandle& Handle, FRotator& OutValue) const;
 
 	UFUNCTION(BlueprintCallable, Category="Shared Variables|CompressedRotator", meta=(AutoCreateRefTerm="VariableName"))
 	void SetSharedCompressedRotator(const FName& VariableName, FRotator NewValue, UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool SetSharedCompressedRotator(const FName& VariableName, FRotator NewValue);
+	bool SetSharedCompressedRotator(const FGMCE_SharedVariableHandle& Handle, FRotator NewValue);
 
 	void BindSharedCompressedRotatorVariables();
+	bool BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::CompressedRotator>& Variable);
 #pragma endregion
 
 	// SharedVars - ActorReference
@@ -354,12 +757,15 @@ public:
 	void GetSharedActorReference(const FName& VariableName, UPARAM(DisplayName="Value") AActor*& OutValue,
 	                UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool GetSharedActorReference(const FName& VariableName, AActor*& OutValue);
+	bool GetSharedActorReference(const FGMCE_SharedVariableHandle& Handle, AActor*& OutValue) const;
 
 	UFUNCTION(BlueprintCallable, Category="Shared Variables|ActorReference", meta=(AutoCreateRefTerm="VariableName"))
 	void SetSharedActorReference(const FName& VariableName, AActor* NewValue, UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool SetSharedActorReference(const FName& VariableName, AActor* NewValue);
+	bool SetSharedActorReference(const FGMCE_SharedVariableHandle& Handle, AActor* NewValue);
 
 	void BindSharedActorReferenceVariables();
+	bool BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::ActorReference>& Variable);
 #pragma endregion
 
 	// SharedVars - ActorComponentReference
@@ -373,12 +779,15 @@ public:
 	void GetSharedActorComponentReference(const FName& VariableName, UPARAM(DisplayName="Value") UActorComponent*& OutValue,
 	                UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool GetSharedActorComponentReference(const FName& VariableName, UActorComponent*& OutValue);
+	bool GetSharedActorComponentReference(const FGMCE_SharedVariableHandle& Handle, UActorComponent*& OutValue) const;
 
 	UFUNCTION(BlueprintCallable, Category="Shared Variables|ActorComponentReference", meta=(AutoCreateRefTerm="VariableName"))
 	void SetSharedActorComponentReference(const FName& VariableName, UActorComponent* NewValue, UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool SetSharedActorComponentReference(const FName& VariableName, UActorComponent* NewValue);
+	bool SetSharedActorComponentReference(const FGMCE_SharedVariableHandle& Handle, UActorComponent* NewValue);
 
 	void BindSharedActorComponentReferenceVariables();
+	bool BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::ActorComponentReference>& Variable);
 #pragma endregion
 
 	// SharedVars - AnimMontageReference
@@ -392,12 +801,15 @@ public:
 	void GetSharedAnimMontageReference(const FName& VariableName, UPARAM(DisplayName="Value") UAnimMontage*& OutValue,
 	                UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool GetSharedAnimMontageReference(const FName& VariableName, UAnimMontage*& OutValue);
+	bool GetSharedAnimMontageReference(const FGMCE_SharedVariableHandle& Handle, UAnimMontage*& OutValue) const;
 
 	UFUNCTION(BlueprintCallable, Category="Shared Variables|AnimMontageReference", meta=(AutoCreateRefTerm="VariableName"))
 	void SetSharedAnimMontageReference(const FName& VariableName, UAnimMontage* NewValue, UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool SetSharedAnimMontageReference(const FName& VariableName, UAnimMontage* NewValue);
+	bool SetSharedAnimMontageReference(const FGMCE_SharedVariableHandle& Handle, UAnimMontage* NewValue);
 
 	void BindSharedAnimMontageReferenceVariables();
+	bool BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::AnimMontageReference>& Variable);
 #pragma endregion
 
 	// SharedVars - Name
@@ -411,12 +823,15 @@ public:
 	void GetSharedName(const FName& VariableName, UPARAM(DisplayName="Value") FName& OutValue,
 	                UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool GetSharedName(const FName& VariableName, FName& OutValue);
+	bool GetSharedName(const FGMCE_SharedVariableHandle& Handle, FName& OutValue) const;
 
 	UFUNCTION(BlueprintCallable, Category="Shared Variables|Name", meta=(AutoCreateRefTerm="VariableName"))
 	void SetSharedName(const FName& VariableName, FName NewValue, UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool SetSharedName(const FName& VariableName, FName NewValue);
+	bool SetSharedName(const FGMCE_SharedVariableHandle& Handle, FName NewValue);
 
 	void BindSharedNameVariables();
+	bool BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::Name>& Variable);
 #pragma endregion
 
 	// SharedVars - GameplayTag
@@ -430,12 +845,15 @@ public:
 	void GetSharedGameplayTag(const FName& VariableName, UPARAM(DisplayName="Value") FGameplayTag& OutValue,
 	                UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool GetSharedGameplayTag(const FName& VariableName, FGameplayTag& OutValue);
+	bool GetSharedGameplayTag(const FGMCE_SharedVariableHandle& Handle, FGameplayTag& OutValue) const;
 
 	UFUNCTION(BlueprintCallable, Category="Shared Variables|GameplayTag", meta=(AutoCreateRefTerm="VariableName"))
 	void SetSharedGameplayTag(const FName& VariableName, FGameplayTag NewValue, UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool SetSharedGameplayTag(const FName& VariableName, FGameplayTag NewValue);
+	bool SetSharedGameplayTag(const FGMCE_SharedVariableHandle& Handle, FGameplayTag NewValue);
 
 	void BindSharedGameplayTagVariables();
+	bool BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::GameplayTag>& Variable);
 #pragma endregion
 
 	// SharedVars - GameplayTagContainer
@@ -449,14 +867,98 @@ public:
 	void GetSharedGameplayTagContainer(const FName& VariableName, UPARAM(DisplayName="Value") FGameplayTagContainer& OutValue,
 	                UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool GetSharedGameplayTagContainer(const FName& VariableName, FGameplayTagContainer& OutValue);
+	bool GetSharedGameplayTagContainer(const FGMCE_SharedVariableHandle& Handle, FGameplayTagContainer& OutValue) const;
 
 	UFUNCTION(BlueprintCallable, Category="Shared Variables|GameplayTagContainer", meta=(AutoCreateRefTerm="VariableName"))
 	void SetSharedGameplayTagContainer(const FName& VariableName, FGameplayTagContainer NewValue, UPARAM(DisplayName="Success") bool& bOutSuccess);
 	bool SetSharedGameplayTagContainer(const FName& VariableName, FGameplayTagContainer NewValue);
+	bool SetSharedGameplayTagContainer(const FGMCE_SharedVariableHandle& Handle, FGameplayTagContainer NewValue);
 
 	void BindSharedGameplayTagContainerVariables();
+	bool BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::GameplayTagContainer>& Variable);
 #pragma endregion
 
+	// SharedVars - InstancedStruct
+	// Struct-typed shared variables are bound through GMC's instanced struct binding, and report changes per
+	// top-level field via OnSharedInstancedStructChange rather than for the struct as a whole.
+#pragma region
+	UFUNCTION(BlueprintCallable, Category="Shared Variables|InstancedStruct", meta=(AutoCreateRefTerm="VariableName"))
+	void MakeSharedInstancedStruct(const FName& VariableName, FInstancedStruct DefaultValue, EGMC_PredictionMode PredictionRule = EGMC_PredictionMode::ServerAuth_Output_ClientValidated,
+					 EGMC_CombineMode CombineRule = EGMC_CombineMode::AlwaysCombine, EGMC_SimulationMode SimulationRule = EGMC_SimulationMode::Periodic_Output,
+					 EGMC_InterpolationFunction InterpolationRule = EGMC_InterpolationFunction::NearestNeighbour);
+
+	UFUNCTION(BlueprintCallable, Category="Shared Variables|InstancedStruct", meta=(AutoCreateRefTerm="VariableName"))
+	void GetSharedInstancedStruct(const FName& VariableName, UPARAM(DisplayName="Value") FInstancedStruct& OutValue,
+	                UPARAM(DisplayName="Success") bool& bOutSuccess);
+	bool GetSharedInstancedStruct(const FName& VariableName, FInstancedStruct& OutValue);
+	bool GetSharedInstancedStruct(const FGMCE_SharedVariableHandle& Handle, FInstancedStruct& OutValue) const;
+
+	UFUNCTION(BlueprintCallable, Category="Shared Variables|InstancedStruct", meta=(AutoCreateRefTerm="VariableName"))
+	void SetSharedInstancedStruct(const FName& VariableName, FInstancedStruct NewValue, UPARAM(DisplayName="Success") bool& bOutSuccess);
+	bool SetSharedInstancedStruct(const FName& VariableName, FInstancedStruct NewValue);
+	bool SetSharedInstancedStruct(const FGMCE_SharedVariableHandle& Handle, FInstancedStruct NewValue);
+
+	void BindSharedInstancedStructVariables();
+	bool BindSharedVariable(TGMCE_TypedSharedVariable<EGMCE_SharedVariableType::InstancedStruct>& Variable);
+#pragma endregion
+
+	/// If set, shared variables declared in this schema are created in one pass just before binding, and bound in
+	/// the order the schema declares them.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Shared Variables")
+	TObjectPtr<UGMCE_SharedVariableSchema> SharedVariableSchema;
+
+	/// If true, Bool shared variables with nearest-neighbour interpolation are packed 32 to a word and bound to
+	/// GMC as integers, one word per set of identical replication rules, rather than bound one by one. Must
+	/// match between server and client, and changes the replicated layout.
+	///
+	/// This does not save bandwidth: an individually bound Bool costs one bit, while a packed word costs 32 bits
+	/// however many of its bits are in use. What it saves is bindings, trading up to 32 of GMC's Bool bindings for
+	/// one of its Int bindings, which then aren't available to Int shared variables.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Shared Variables")
+	bool bPackSharedBools { false };
+
+	/// The fewest Bools worth packing into a word. At 32, only full words are packed, which costs no extra bits;
+	/// lower values pack partial words too, spending up to 32 bits per word to save Bool bindings. Variables which
+	/// don't make up a word are bound one by one.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Shared Variables", meta=(EditCondition="bPackSharedBools", ClampMin=2, ClampMax=32))
+	int32 SharedBoolPackingMinGroupSize { 32 };
+
+	/// If false, shared variable change detection is suspended while a client replays moves after a correction;
+	/// the net change is reported once, on the first move executed after the replay finishes.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Shared Variables")
+	bool bNotifySharedVariablesDuringReplay { false };
+
+	/// If false, change detection is never run on simulated proxies. Disable this if nothing listens for shared
+	/// variable changes on remote pawns.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Shared Variables")
+	bool bNotifySharedVariablesOnSimulatedProxies { true };
+
+	/// Every shared variable made on this component (including any which failed to bind) with its bind index,
+	/// replication rules and estimated serialized size. Typed member variables are listed after the rest, once bound.
+	UFUNCTION(BlueprintCallable, Category="Shared Variables")
+	TArray<FGMCE_SharedVariableReportEntry> GetSharedVariableReport() const;
+
+	/// Log the shared variable report, followed by per-type totals. Also available as the console command
+	/// gmce.SharedVariables.Report.
+	UFUNCTION(BlueprintCallable, Category="Shared Variables")
+	void LogSharedVariableReport() const;
+
+	/// Copy every shared variable value into a snapshot, reusing its buffers. Typed member variables are excluded.
+	void CaptureSharedVariables(FGMCE_SharedVariableSnapshot& OutSnapshot) const;
+
+	/// Restore every shared variable value from a snapshot captured from a component with the same shared
+	/// variables. Changed values are flagged for change notification as if they had been set. Returns false (and
+	/// changes nothing) if the snapshot's layout doesn't match.
+	bool RestoreSharedVariables(const FGMCE_SharedVariableSnapshot& Snapshot);
+
+	/// True if anything is listening for shared variable changes, on any type.
+	bool HasSharedVariableListeners() const;
+
+	/// Native notification fired at most once per change-detection pass, listing every shared variable (of any
+	/// type) which changed during it. Cheaper than the per-type dynamic delegates when many variables change at
+	/// once, such as during server state adoption or a replay.
+	FOnSharedVariablesChanged OnSharedVariablesChanged;
+
 	UPROPERTY(BlueprintAssignable, Category="Shared Variables|Bool", meta=(AutoCreateRefTerm="VariableName"))
 	FOnSharedBoolChange OnSharedBoolChange;
 
@@ -511,6 +1013,11 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="Shared Variables|GameplayTagContainer", meta=(AutoCreateRefTerm="VariableName"))
 	FOnSharedGameplayTagContainerChange OnSharedGameplayTagContainerChange;
 
+	/// Fired once per changed top-level field of a struct-typed shared variable, with FieldName set to that field.
+	/// If the variable's struct type changed, fires once with FieldName set to None.
+	UPROPERTY(BlueprintAssignable, Category="Shared Variables|InstancedStruct", meta=(AutoCreateRefTerm="VariableName"))
+	FOnSharedInstancedStructChange OnSharedInstancedStructChange;
+
 private:
 	// --- External binding records for all registered-by-others bindings.
 	SHARED_VARIABLES(Bool, bool)
@@ -531,8 +1038,78 @@ private:
 	SHARED_VARIABLES(Name, FName)
 	SHARED_VARIABLES(GameplayTag, FGameplayTag)
 	SHARED_VARIABLES(GameplayTagContainer, FGameplayTagContainer)
+	SHARED_VARIABLES(InstancedStruct, FInstancedStruct)
 
 	bool bHasFinishedBinding { true };
+
+	/// Set once shared variables have been bound to GMC. Variable storage must not grow after this point, since
+	/// GMC holds references into it.
+	bool bSharedVariablesBound { false };
+
+	bool CanMakeSharedVariable(const FName& VariableName) const;
+
+	/// A variable is only made once; later attempts are ignored. Warn if one of those (typically a component making
+	/// a variable the schema already declares) asked for a different default value or different replication rules.
+	template<typename T>
+	void WarnIfSharedVariableRedefined(EGMCE_SharedVariableType Type, const TGMCE_SharedVariable<T>& Existing, const T& DefaultValue,
+		EGMC_PredictionMode PredictionRule, EGMC_CombineMode CombineRule, EGMC_SimulationMode SimulationRule,
+		EGMC_InterpolationFunction InterpolationRule) const;
+
+	/// Bound words for packed Bool shared variables. Sized once at bind time and never grown afterwards.
+	TArray<FGMCE_PackedSharedBools> PackedSharedBools;
+
+	/// For each Bool slot, its packed location (Word * 32 + Bit), or INDEX_NONE if bound individually.
+	TArray<int32> PackedBoolLocations;
+
+	/// For each packed location, the Bool slot stored there (or INDEX_NONE for unused bits).
+	TArray<int32> PackedBoolSlots;
+
+	bool ReadSharedBool(int32 Slot) const;
+	void WriteSharedBool(int32 Slot, bool NewValue);
+
+	/// Copy any packed bits GMC has written since the last call into their Bool variables, marking them dirty.
+	void UnpackSharedBools();
+
+	void LogFailedSharedVariableBind(EGMCE_SharedVariableType Type, const FName& VariableName) const;
+
+	template<typename T>
+	static void CaptureSharedVariableStore(const TGMCE_SharedVariableStore<T>& Store, FGMCE_SharedVariableSnapshot& Snapshot);
+	static void CaptureSharedVariableStore(const TGMCE_SharedVariableStore<FGameplayTagContainer>& Store, FGMCE_SharedVariableSnapshot& Snapshot);
+	static void CaptureSharedVariableStore(const TGMCE_SharedVariableStore<FInstancedStruct>& Store, FGMCE_SharedVariableSnapshot& Snapshot);
+
+	template<typename T>
+	static void RestoreSharedVariableStore(TGMCE_SharedVariableStore<T>& Store, const FGMCE_SharedVariableSnapshot& Snapshot, int32& Offset);
+	static void RestoreSharedVariableStore(TGMCE_SharedVariableStore<FGameplayTagContainer>& Store, const FGMCE_SharedVariableSnapshot& Snapshot);
+	static void RestoreSharedVariableStore(TGMCE_SharedVariableStore<FInstancedStruct>& Store, const FGMCE_SharedVariableSnapshot& Snapshot);
+
+	/// Create every variable declared in SharedVariableSchema, if any.
+	void ApplySharedVariableSchema();
+
+	/// Change notification for struct-typed variables, which diff field by field rather than as a whole.
+	void NotifySharedInstancedStructChanges(bool bCollectChanges);
+
+	/// Which variables the current check compares against their last notified value, besides those already dirty.
+	EGMCE_SharedVariableGather SharedVariableGather { EGMCE_SharedVariableGather::All };
+
+	/// Set when GMC may have written bound values while change detection was skipped (during replays, or with no
+	/// listeners); the next check then compares everything.
+	bool bSharedVariableFullGatherOwed { false };
+
+	template<EGMCE_SharedVariableType Type, typename BindFunction>
+	bool BindTypedSharedVariable(TGMCE_TypedSharedVariable<Type>& Variable, BindFunction&& Bind);
+
+	/// Typed shared variables registered during OnBindSharedVariables, bound together once all are registered.
+	TArray<FGMCE_PendingTypedSharedVariable> PendingTypedSharedVariables;
+
+	/// Bind every registered typed shared variable, sorted by type and then name.
+	void BindPendingTypedSharedVariables();
+
+	/// Report entries for typed shared variables, recorded as each is bound since the component doesn't keep them.
+	/// Sizes of variable-size values are estimated from their value at bind time.
+	TArray<FGMCE_SharedVariableReportEntry> TypedSharedVariableReport;
+
+	/// Reused between passes so that building the aggregated change list doesn't allocate every move.
+	TArray<FGMCE_SharedVariableChange> PendingSharedVariableChanges;
 	
 };
 
@@ -3,9 +3,11 @@
 #include "CoreMinimal.h"
 #include "GMCE_CoreComponent.h"
 #include "GMCOrganicMovementComponent.h"
-#include "Containers/RingBuffer.h"
 #include "Solvers/GMCE_BaseSolver.h"
+#include "Support/GMCEMovementHistory.h"
 #include "Support/GMCEMovementSample.h"
+#include "Support/GMCETrajectoryPrediction.h"
+#include "WorldCollision.h"
 #include "GMCE_OrganicMovementCmp.generated.h"
 
 // We append GMC to the delegate name because Epic decided to add an FOnProcessRootMotion to the CMC in 5.4.
@@ -14,6 +16,7 @@ DECLARE_DELEGATE_TwoParams(FOnSyncDataApplied, const FGMC_PawnState&, EGMC_NetCo
 DECLARE_DELEGATE(FOnBindReplicationData)
 
 class UGMCE_BaseSolver;
+class UGMCE_TrajectorySubsystem;
 
 USTRUCT(BlueprintType)
 struct GMCEXTENDED_API FGMCE_SpeedMark
@@ -57,6 +60,8 @@ protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 public:
 	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
@@ -381,9 +386,15 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Movement Trajectory", meta=(UIMin="30", UIMax="179"))
 	float PivotPredictionAngleThreshold { 90.f };
 	
+	/// Closed form for braking at BrakingDeceleration * Friction. Matches stepped trajectory prediction to within half
+	/// a sample's travel, plus half of one sample's worth of deceleration; it is never short. DeltaTime is unused.
 	UFUNCTION(BlueprintPure, Category="Trajectory Matching", meta=(ToolTip="Returns a predicted point relative to the actor where they'll come to a stop.", BlueprintThreadSafe))
 	static FVector PredictGroundedStopLocation(const FVector& CurrentVelocity, float BrakingDeceleration, float Friction, float DeltaTime);
 
+	/// Closed form for trajectory prediction's pivot model, treating speed as the sum of the speed being reversed and
+	/// the speed across the acceleration, which is exact for a straight reversal. Matches stepped trajectory
+	/// prediction to within 5% of the pivot distance plus one sample's travel at 60 samples a second, and within
+	/// 15% from 30 to 120. CurrentRotation and DeltaTime are unused.
 	UFUNCTION(BlueprintPure, Category="Trajectory Matching", meta=(ToolTip="Returns a predicted point relative to the actor where they'll finish a pivot.", BlueprintThreadSafe))
 	static FVector PredictGroundedPivotLocation(const FVector& CurrentAcceleration, const FVector& CurrentVelocity, const FRotator& CurrentRotation, float Friction, float DeltaTime, float AngleThreshold = 90.f);
 
@@ -456,6 +467,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Movement Trajectory")
 	FGMCE_MovementSampleCollection GetMovementHistory(bool bOmitLatest) const;
 
+	/// Read-only view over the historical trajectory samples, for native code which wants to scan or search the
+	/// history without copying it. Indices are only stable until the next sample is added.
+	FGMCE_MovementHistoryView GetMovementHistoryView() const { return FGMCE_MovementHistoryView(MovementSamples); }
+
 	/// Given the historical samples, predict the future trajectory a character will take. Coordinates are relative
 	/// to the origin point provided.
 	UFUNCTION(BlueprintCallable, Category="Movement Trajectory")
@@ -465,6 +480,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Movement Trajectory")
 	virtual void UpdateTrajectoryPrediction();
 
+	/// Velocity over roughly the last tenth of a second of movement history.
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Movement Trajectory")
 	FVector GetCurrentVelocityFromHistory();
 	
@@ -476,6 +492,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Movement Trajectory|Precalculations")
 	bool bPrecalculateFutureTrajectory { true };
 
+	/// If true, precalculated trajectory predictions are handed to the trajectory subsystem, which runs every
+	/// participating pawn's prediction in parallel at the end of the frame. Overrides of UpdateTrajectoryPrediction
+	/// are bypassed in that case, and pawns using synchronous collision prediction always predict on their own.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory|Precalculations")
+	bool bPredictTrajectoryInParallel { false };
+
 	/// If true, trajectory will be calculated based on the character's skeletal mesh (if possible) rather than the
 	/// root component.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Movement Trajectory")
@@ -507,6 +529,47 @@ public:
 	/// How long, in seconds, we should wait between samples. 0 will use a sane-but-frequent default.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory")
 	float TrajectoryHistoryPeriod { 0 };
+
+	/// If true, history samples are taken on a fixed time grid, interpolated between frames, rather than whenever
+	/// a frame comes along after the period has passed. The grid is laid over GMC's synchronized server time, so
+	/// the history looks the same regardless of frame rate, on the server and on every client.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory")
+	bool bTrajectoryHistoryFixedRate { false };
+
+	/// How many history samples to take per second, in fixed-rate mode. A longer TrajectoryHistoryPeriod wins.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory", meta=(EditCondition="bTrajectoryHistoryFixedRate", ClampMin="1"))
+	int32 TrajectoryHistoryFixedSampleRate { 30 };
+
+	/// If true, history samples which can be interpolated back from their neighbours are dropped once they're a
+	/// tenth of a second old, so a pawn moving steadily keeps a handful of keyframes rather than a sample every
+	/// period. The most recent tenth of a second, which the history estimates are taken over, is always kept in
+	/// full. The time window and sample limit above still apply to whatever is kept.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory")
+	bool bTrajectoryHistoryKeyframeReduction { false };
+
+	/// How far, in units, an interpolated history location may be from the sample it replaces.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory", meta=(EditCondition="bTrajectoryHistoryKeyframeReduction", ClampMin="0"))
+	float TrajectoryHistoryPositionTolerance { 1.f };
+
+	/// How far, in degrees, an interpolated history rotation (sample or actor) may be from the sample it replaces.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory", meta=(EditCondition="bTrajectoryHistoryKeyframeReduction", ClampMin="0"))
+	float TrajectoryHistoryRotationTolerance { 1.f };
+
+	/// How far, in degrees, an interpolated history controller yaw may be from the sample it replaces.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory", meta=(EditCondition="bTrajectoryHistoryKeyframeReduction", ClampMin="0"))
+	float TrajectoryHistoryControllerYawTolerance { 2.f };
+
+	/// How far, in degrees, an interpolated history mesh relative yaw may be from the sample it replaces.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory", meta=(EditCondition="bTrajectoryHistoryKeyframeReduction", ClampMin="0"))
+	float TrajectoryHistoryMeshYawTolerance { 1.f };
+
+	/// How far, in units per second, an interpolated history velocity may be from the sample it replaces.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory", meta=(EditCondition="bTrajectoryHistoryKeyframeReduction", ClampMin="0"))
+	float TrajectoryHistoryVelocityTolerance { 10.f };
+
+	/// How far, in units per second squared, an interpolated history acceleration may be from the sample it replaces.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory", meta=(EditCondition="bTrajectoryHistoryKeyframeReduction", ClampMin="0"))
+	float TrajectoryHistoryAccelerationTolerance { 50.f };
 	
 	/// How many simulated samples should be generated for each second, when predicting trajectory?
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory")
@@ -519,7 +582,57 @@ public:
 	/// Whether predicted trajectory should adhere to the ground.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory")
 	bool bTrajectoryPredictCollisions { false };
-	
+
+	/// If true, collision prediction queues its ground probes as async traces and applies the results on the next
+	/// prediction, rather than tracing synchronously for every sample. Results lag a frame behind.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory", meta=(EditCondition="bTrajectoryPredictCollisions"))
+	bool bTrajectoryAsyncCollisions { true };
+	
+	/// If true, trajectory prediction reuses its last integration when nothing driving it has changed: input,
+	/// movement mode, speed and braking settings, rotation rates, and velocity (within tolerance). Never applies
+	/// while predicting collisions.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory|Precalculations")
+	bool bCacheTrajectoryPrediction { true };
+
+	/// How far, in units per second, velocity can drift before a cached trajectory prediction is recalculated.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory|Precalculations", meta=(EditCondition="bCacheTrajectoryPrediction", ClampMin="0"))
+	float TrajectoryCacheVelocityTolerance { 1.f };
+
+	/// If true, pawns other than a local player's own pawn (including AI pawns) scale their trajectory history and
+	/// prediction down by their significance: how close they are to the nearest viewer, and whether they're on screen.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory|Significance")
+	bool bTrajectorySignificanceEnabled { false };
+
+	/// Distance from the nearest viewer at which significance starts to fall off, and at which it bottoms out.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory|Significance", meta=(EditCondition="bTrajectorySignificanceEnabled"))
+	FVector2D TrajectorySignificanceDistance { 1500.f, 8000.f };
+
+	/// Significance is multiplied by this when the pawn hasn't been rendered recently. Ignored on dedicated servers.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory|Significance", meta=(EditCondition="bTrajectorySignificanceEnabled", ClampMin="0", ClampMax="1"))
+	float TrajectoryOffscreenSignificanceScale { 0.5f };
+
+	/// The lowest significance automatic calculation will produce.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory|Significance", meta=(EditCondition="bTrajectorySignificanceEnabled", ClampMin="0", ClampMax="1"))
+	float TrajectoryMinSignificance { 0.2f };
+
+	/// Below this significance, predicted trajectories don't check for collisions.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Movement Trajectory|Significance", meta=(ClampMin="0", ClampMax="1"))
+	float TrajectoryCollisionMinSignificance { 0.5f };
+
+	/// If zero or more, used as the trajectory significance instead of calculating it. Works even when
+	/// significance is otherwise disabled.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Movement Trajectory|Significance", meta=(ClampMax="1"))
+	float TrajectorySignificanceOverride { -1.f };
+
+	/// Write the last predicted trajectory (including history) into an existing pose search trajectory, reusing its
+	/// storage. If any sample times are given, the trajectory is resampled to them.
+	UFUNCTION(BlueprintCallable, Category="Movement Trajectory")
+	void ExportPredictedTrajectory(UPARAM(ref) FPoseSearchQueryTrajectory& OutTrajectory, const TArray<float>& SampleTimes) const;
+
+	/// Current trajectory significance, from 0 to 1. 1 means full-detail history and prediction.
+	UFUNCTION(BlueprintPure, Category="Movement Trajectory|Significance")
+	float GetTrajectorySignificance() const { return TrajectorySignificance; }
+
 	/// The last predicted trajectory. Only valid if PrecalculateFutureTrajectory is true, or
 	/// UpdateTrajectoryPrediction has been manually called.
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category="Movement Trajectory")
@@ -531,11 +644,18 @@ protected:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Movement Trajectory")
 	FGMCE_MovementSample GetMovementSampleFromCurrentState() const;
 
-	/// Add a new movement sample to the history, accumulating time and transform to
-	/// all previous samples.
+	/// Add a new movement sample to the history. Previous samples are left untouched; their time and transform
+	/// relative to the new sample are derived when read.
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Movement Trajectory")
 	void AddNewMovementSample(const FGMCE_MovementSample& Sample);
 
+	/// Add a new movement sample to the history, as taken at the given game time.
+	void AddMovementSampleAt(const FGMCE_MovementSample& Sample, float GameSeconds);
+
+	/// The clock history samples are timed against: GMC's synchronized server time in fixed-rate mode, and local
+	/// game time otherwise.
+	float GetTrajectoryHistoryTime() const;
+
 	/// Clear out old samples from the trajectory sample history.
 	void CullMovementSampleHistory(bool bIsNearlyZero, const FGMCE_MovementSample& LatestSample);
 
@@ -545,17 +665,103 @@ protected:
 	UFUNCTION(BlueprintNativeEvent, Category="Movement Trajectory")
 	void UpdateMovementSamples();
 
-	/// Get our current acceleration and rotational velocity from our historical movement samples.
+	/// Recalculate trajectory significance. Called once per frame before any trajectory work.
+	void UpdateTrajectorySignificance();
+
+	/// Trajectory settings, scaled by our current significance.
+	int32 GetEffectiveMaxTrajectorySamples() const;
+	float GetEffectiveTrajectoryHistoryPeriod() const;
+	int32 GetEffectiveTrajectorySimSampleRate() const;
+	float GetEffectiveTrajectorySimSeconds() const;
+
+	/// The transform and mesh offset which UpdateTrajectoryPrediction predicts from.
+	void GetTrajectoryPredictionOrigin(FTransform& OutOrigin, FQuat& OutMeshOffset) const;
+
+	/// Game thread half of the prediction setup: gather input and read back last frame's ground probes. Returns true
+	/// if this prediction's ground probes should be queued once it has run.
+	bool BeginTrajectoryPrediction(const FTransform& FromOrigin, const FRotator& ControllerRotation, const FQuat& MeshOffset, FGMCE_TrajectoryPredictionInput& OutInput);
+
+	/// Run a prediction from gathered input. Only touches this component's prediction buffers and reads its
+	/// history, so different components can run this concurrently.
+	void RunTrajectoryPrediction(const FGMCE_TrajectoryPredictionInput& Input, bool bIncludeHistory, FGMCE_MovementSampleCollection& OutPredictions);
+
+	/// Whether this component's predictions can be run by the trajectory subsystem.
+	bool CanPredictTrajectoryInParallel() const;
+
+	/// Collect everything trajectory prediction needs from our current state.
+	void GatherTrajectoryPredictionInput(const FTransform& FromOrigin, const FRotator& ControllerRotation, const FQuat& MeshOffset, FGMCE_TrajectoryPredictionInput& OutInput);
+
+	/// Step the trajectory prediction forward, writing world-space results into packed buffers. No movement samples
+	/// are built here; see FGMCE_TrajectoryPredictionBuffers. Static, so that it depends on nothing but the input.
+	static void IntegrateTrajectory(const FGMCE_TrajectoryPredictionInput& Input, FGMCE_TrajectoryPredictionBuffers& Output);
+
+	/// Read back the async ground probes queued by the last prediction.
+	void CollectTrajectoryGroundTraces();
+
+	/// Queue async traces for the ground probes of a prediction, to be read back on the next one.
+	void QueueTrajectoryGroundTraces(const FGMCE_TrajectoryPredictionBuffers& Buffers);
+
+	/// Get our current acceleration and rotational velocity from our historical movement samples. These are
+	/// estimated once per added sample, so repeated calls within a frame are cheap and agree with each other.
 	void GetCurrentAccelerationRotationVelocityFromHistory(FVector& OutAcceleration, FRotator& OutRotationVelocity, const EGMCE_TrajectoryRotationType& RotationType) const;
 
 private:
 
-	TRingBuffer<FGMCE_MovementSample> MovementSamples;
+	FGMCE_MovementHistory MovementSamples;
 	FGMCE_MovementSample LastMovementSample;
 	
 	float LastTrajectoryGameSeconds { 0.f };
 
+	/// In fixed-rate history mode, the grid point the last sample was taken at and the grid's spacing. Kept as an
+	/// index, since working it back out of a float time can land on the point before.
+	int64 TrajectoryHistoryGridIndex { 0 };
+	double TrajectoryHistoryGridPeriod { 0.0 };
+
 	float EffectiveTrajectoryTimeDomain { 0.f };	
+
+	/// Recalculate the history estimates below against the latest sample.
+	void UpdateHistoryEstimates();
+
+	static constexpr int32 NumTrajectoryRotationTypes = static_cast<int32>(EGMCE_TrajectoryRotationType::Travel) + 1;
+
+	/// How far back the history estimates look. Keyframe reduction leaves this much history untouched.
+	static constexpr float HistoryEstimateSeconds = 0.1f;
+
+	/// Kinematic estimates over roughly the last tenth of a second of history, updated whenever a sample is added.
+	FVector HistoryVelocityEstimate { 0.f };
+	FVector HistoryAccelerationEstimate { 0.f };
+	FRotator HistoryRotationVelocityEstimates[NumTrajectoryRotationTypes];
+
+	/// Scratch space for trajectory prediction, kept around to avoid reallocating every frame.
+	FGMCE_TrajectoryPredictionBuffers TrajectoryPredictionBuffers;
+
+	/// The input the prediction buffers currently hold the integration of.
+	FGMCE_TrajectoryPredictionInput CachedTrajectoryInput;
+	bool bHasCachedTrajectoryInput { false };
+
+	/// Async ground probes in flight, by sample index, and the results of the last batch to come back.
+	TArray<FTraceHandle> PendingTrajectoryGroundTraces;
+	TArray<TOptional<FHitResult>> TrajectoryGroundHits;
+	uint64 TrajectoryGroundTraceFrame { 0 };
+
+	/// The sample layout the ground hits were traced for; hits from any other layout are thrown away.
+	int32 TrajectoryGroundHitsNumSamples { 0 };
+	float TrajectoryGroundHitsTimePerSample { 0.f };
+
+	/// Always one of a few discrete levels, so that the sample layouts derived from it stay put between levels.
+	float TrajectorySignificance { 1.f };
+	static constexpr float TrajectorySignificanceLevels = 4.f;
+
+	/// The subsystem we're registered with for parallel prediction or read viewer locations from, if any, and
+	/// whether we want it to predict for us this frame.
+	TWeakObjectPtr<UGMCE_TrajectorySubsystem> TrajectorySubsystem;
+	bool bTrajectoryPredictionQueued { false };
+
+	friend class UGMCE_TrajectorySubsystem;
+
+#if WITH_DEV_AUTOMATION_TESTS
+	friend class FGMCE_StopPivotPredictionTest;
+#endif
 	
 #pragma endregion
 
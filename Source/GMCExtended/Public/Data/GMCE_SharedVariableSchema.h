@@ -0,0 +1,116 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/GMCE_CoreComponent.h"
+#include "Engine/DataAsset.h"
+#include "Misc/TVariant.h"
+#include "GMCE_SharedVariableSchema.generated.h"
+
+/// A shared variable value of any of the types shared variables are stored as.
+using FGMCE_SharedVariableValue = TVariant<bool, uint8, int32, float, double, FVector2D, FVector, FRotator, AActor*,
+	UActorComponent*, UAnimMontage*, FName, FGameplayTag, FGameplayTagContainer, FInstancedStruct>;
+
+/// A single shared variable, as declared in a schema.
+USTRUCT(BlueprintType)
+struct GMCEXTENDED_API FGMCE_SharedVariableDefinition
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Shared Variable")
+	FName VariableName { NAME_None };
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Shared Variable")
+	EGMCE_SharedVariableType Type { EGMCE_SharedVariableType::Bool };
+
+	/// The variable's initial value as text, in the format the type's ToString() produces: "true", "42", "1.5",
+	/// "X=1 Y=2 Z=3", a tag name, or a comma-separated list of tag names. Empty means the type's default. Actor
+	/// and component references can't be given a default here.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Shared Variable", meta=(EditCondition="Type != EGMCE_SharedVariableType::InstancedStruct && Type != EGMCE_SharedVariableType::AnimMontageReference", EditConditionHides))
+	FString DefaultValue;
+
+	/// The initial value of an AnimMontageReference variable.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Shared Variable", meta=(EditCondition="Type == EGMCE_SharedVariableType::AnimMontageReference", EditConditionHides))
+	TObjectPtr<UAnimMontage> DefaultMontage;
+
+	/// The initial value of an InstancedStruct variable.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Shared Variable", meta=(EditCondition="Type == EGMCE_SharedVariableType::InstancedStruct", EditConditionHides))
+	FInstancedStruct DefaultStruct;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Shared Variable")
+	EGMC_PredictionMode PredictionRule { EGMC_PredictionMode::ServerAuth_Output_ClientValidated };
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Shared Variable")
+	EGMC_CombineMode CombineRule { EGMC_CombineMode::AlwaysCombine };
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Shared Variable")
+	EGMC_SimulationMode SimulationRule { EGMC_SimulationMode::Periodic_Output };
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Shared Variable")
+	EGMC_InterpolationFunction InterpolationRule { EGMC_InterpolationFunction::NearestNeighbour };
+
+	/// Parse the default value as the type this variable is stored as. Returns false, leaving OutValue at the
+	/// type's default, if it can't be parsed.
+	bool GetDefaultValue(bool& OutValue) const;
+	bool GetDefaultValue(uint8& OutValue) const;
+	bool GetDefaultValue(int32& OutValue) const;
+	bool GetDefaultValue(float& OutValue) const;
+	bool GetDefaultValue(double& OutValue) const;
+	bool GetDefaultValue(FVector2D& OutValue) const;
+	bool GetDefaultValue(FVector& OutValue) const;
+	bool GetDefaultValue(FRotator& OutValue) const;
+	bool GetDefaultValue(AActor*& OutValue) const;
+	bool GetDefaultValue(UActorComponent*& OutValue) const;
+	bool GetDefaultValue(UAnimMontage*& OutValue) const;
+	bool GetDefaultValue(FName& OutValue) const;
+	bool GetDefaultValue(FGameplayTag& OutValue) const;
+	bool GetDefaultValue(FGameplayTagContainer& OutValue) const;
+	bool GetDefaultValue(FInstancedStruct& OutValue) const;
+
+	/// True if the default value can be parsed as this variable's type.
+	bool IsDefaultValueValid() const;
+};
+
+/**
+ * Declares the full set of shared variables a pawn uses. A core component with a schema assigned builds its
+ * shared variable storage from it in a single preallocated pass before binding, and binds those variables in
+ * schema order rather than sorting them by name. Variables are created with their declared default value.
+ *
+ * Components may still make additional variables at runtime; if they do, binding falls back to name order for
+ * the affected types. A component making a variable the schema already declares keeps the schema's definition,
+ * and a warning is logged if it asked for a different default value or different replication rules.
+ */
+UCLASS(BlueprintType)
+class GMCEXTENDED_API UGMCE_SharedVariableSchema : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Shared Variables", meta=(TitleProperty="VariableName"))
+	TArray<FGMCE_SharedVariableDefinition> Variables;
+
+	/// Parse every variable's default value into typed storage, so that pawns using this schema copy them rather
+	/// than each parsing them again. Done on load and after editing; call it again after changing Variables at
+	/// runtime.
+	void ParseDefaultValues();
+
+	/// True if the parsed default values are current.
+	bool HasParsedDefaultValues() const { return ParsedDefaultValues.Num() == Variables.Num(); }
+
+	/// The parsed default value of Variables[Index], which must be stored as T.
+	template<typename T>
+	const T& GetParsedDefaultValue(int32 Index) const { return ParsedDefaultValues[Index].Get<T>(); }
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+#endif
+
+private:
+
+	/// Each variable's default value, parsed as the type it's stored as; indexed like Variables.
+	TArray<FGMCE_SharedVariableValue> ParsedDefaultValues;
+	
+};
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/Float16.h"
+#include "Support/GMCEMovementSample.h"
+
+/// A movement sample packed into a single cache line, for anything which holds a lot of them. Location is stored
+/// in single precision relative to an origin kept by whatever holds the sample; rotations are quantized, and
+/// velocity and acceleration are half precision. Expand it into a full FGMCE_MovementSample when one is needed.
+///
+/// Controller rotation, mesh relative rotation and actor delta rotation are stored as yaw only; the relative
+/// fields of a movement sample are not stored at all, since they depend on what they're relative to.
+///
+/// The sample is aligned to a cache line, which a default TArray won't honour; store arrays of them as
+/// FGMCE_CompactMovementSampleArray.
+struct alignas(64) GMCEXTENDED_API FGMCE_CompactMovementSample
+{
+	FGMCE_CompactMovementSample() = default;
+
+	/// Pack a movement sample. Seconds is stored as given; its meaning (game time, accumulated seconds) is up to
+	/// the holder.
+	FGMCE_CompactMovementSample(const FGMCE_MovementSample& Sample, float InSeconds, const FVector& Origin);
+
+	/// Unpack into a full movement sample, with Seconds as its accumulated seconds. Relative fields are left at
+	/// identity.
+	FGMCE_MovementSample Expand(const FVector& Origin) const;
+
+	float GetSeconds() const { return Seconds; }
+	FVector GetWorldLocation(const FVector& Origin) const { return Origin + FVector(Location); }
+	FQuat GetWorldRotation() const { return DecompressQuat(Rotation); }
+	FQuat GetActorWorldRotation() const { return DecompressQuat(ActorRotation); }
+	FVector GetActorWorldLocation(const FVector& Origin) const { return GetWorldLocation(Origin) + FVector(ActorOffset); }
+	FVector GetWorldLinearVelocity() const { return FVector(LinearVelocity[0].GetFloat(), LinearVelocity[1].GetFloat(), LinearVelocity[2].GetFloat()); }
+	FVector GetAcceleration() const { return FVector(Acceleration[0].GetFloat(), Acceleration[1].GetFloat(), Acceleration[2].GetFloat()); }
+	FRotator GetControllerRotation() const { return FRotator(0.f, FRotator::DecompressAxisFromShort(ControllerYaw), 0.f); }
+	float GetMeshComponentRelativeYaw() const { return FRotator::DecompressAxisFromShort(MeshComponentRelativeYaw); }
+	bool IsMarker() const { return bUseAsMarker; }
+
+	/// Location relative to the holder's origin.
+	const FVector3f& GetOffset() const { return Location; }
+
+	/// Move the sample's origin by the given amount, keeping its world location.
+	void Rebase(const FVector3f& OriginDelta) { Location -= OriginDelta; }
+
+	friend FArchive& operator<<(FArchive& Ar, FGMCE_CompactMovementSample& Sample);
+
+	static void CompressQuat(const FQuat& Quat, int16 (&OutComponents)[4]);
+	static FQuat DecompressQuat(const int16 (&Components)[4]);
+
+private:
+
+	float Seconds { 0.f };
+	FVector3f Location { FVector3f::ZeroVector };
+
+	/// Actor location relative to the sample location.
+	FVector3f ActorOffset { FVector3f::ZeroVector };
+
+	int16 Rotation[4] { 0, 0, 0, MAX_int16 };
+	int16 ActorRotation[4] { 0, 0, 0, MAX_int16 };
+	FFloat16 LinearVelocity[3];
+	FFloat16 Acceleration[3];
+	uint16 ControllerYaw { 0 };
+	uint16 MeshComponentRelativeYaw { 0 };
+	uint16 ActorDeltaYaw { 0 };
+	bool bUseAsMarker { false };
+};
+
+static_assert(sizeof(FGMCE_CompactMovementSample) == 64, "FGMCE_CompactMovementSample should fill exactly one cache line.");
+
+using FGMCE_CompactMovementSampleArray = TArray<FGMCE_CompactMovementSample, TAlignedHeapAllocator<alignof(FGMCE_CompactMovementSample)>>;
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Support/GMCECompactMovementSample.h"
+
+/// How far each field of a history sample may be from what interpolating its neighbours gives back, for keyframe
+/// reduction to drop it. Marker samples are never dropped.
+struct FGMCE_MovementHistoryTolerances
+{
+	/// Sample and actor location, in units.
+	float Position { 1.f };
+
+	/// Sample and actor rotation, in degrees.
+	float Rotation { 1.f };
+
+	/// Controller and mesh relative yaw, in degrees.
+	float ControllerYaw { 2.f };
+	float MeshYaw { 1.f };
+
+	/// Linear velocity, in units per second.
+	float Velocity { 10.f };
+
+	/// Acceleration, in units per second squared.
+	float Acceleration { 50.f };
+};
+
+/// Trajectory sample history, stored as compact samples in a fixed-capacity ring. Each sample is a single cache
+/// line; a full FGMCE_MovementSample is only built when asked for with GetSample.
+///
+/// Only world-space data and absolute game time are stored, so adding a sample never touches the older ones.
+/// Locations are kept in single precision relative to an origin near the samples, which is moved along with the
+/// pawn when it strays too far. Relative transforms, relative velocities and accumulated seconds are derived on
+/// demand against the newest sample, which is the origin of the history.
+///
+/// Indices are logical: 0 is the oldest sample, Num() - 1 the newest.
+struct GMCEXTENDED_API FGMCE_MovementHistory
+{
+	int32 Num() const { return Count; }
+	int32 Max() const { return Capacity; }
+	bool IsEmpty() const { return Count == 0; }
+	bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < Count; }
+
+	/// Resize the ring, keeping the newest samples that still fit.
+	void SetCapacity(int32 NewCapacity);
+
+	/// Remove every sample, keeping the current capacity.
+	void Reset();
+
+	/// Append a sample taken at the given game time as the newest entry, dropping the oldest one if the history
+	/// is full. The sample's own relative fields and accumulated seconds are ignored.
+	void Add(const FGMCE_MovementSample& Sample, float InGameSeconds);
+
+	/// Remove the oldest sample.
+	void PopOldest();
+
+	/// Remove the sample at the given index, shifting newer samples down. Cheap near the newest end.
+	void RemoveAt(int32 Index);
+
+	/// Drop samples which, along with every sample dropped since the last one kept, can be interpolated back from
+	/// their neighbours to within the given tolerances. Interpolation is linear in time, with a slerp for rotations
+	/// and the shortest way round for yaws, matching the movement sample collection's.
+	///
+	/// Samples within UnreducedSeconds of the newest, and the newest one before that, are left alone, so anything
+	/// reading the recent past sees every sample. Each sample is considered once, as it leaves that window.
+	/// Returns whether anything was dropped.
+	bool ReduceKeyframes(const FGMCE_MovementHistoryTolerances& Tolerances, float UnreducedSeconds);
+
+	/// Build a full movement sample from the stored fields, relative to the newest sample. Actor delta rotation is
+	/// worked out against the sample before it, since keyframe reduction may have dropped the one it was taken
+	/// against; only the oldest sample keeps the delta it was added with.
+	FGMCE_MovementSample GetSample(int32 Index) const;
+
+	/// Seconds between this sample and the newest one; zero or negative.
+	float GetAccumulatedSeconds(int32 Index) const { return GetGameSeconds(Index) - GetGameSeconds(Count - 1); }
+
+	float GetGameSeconds(int32 Index) const { return Samples[ToPhysical(Index)].GetSeconds(); }
+	FVector GetWorldLocation(int32 Index) const { return Samples[ToPhysical(Index)].GetWorldLocation(Origin); }
+	FQuat GetWorldRotation(int32 Index) const { return Samples[ToPhysical(Index)].GetWorldRotation(); }
+	FVector GetWorldLinearVelocity(int32 Index) const { return Samples[ToPhysical(Index)].GetWorldLinearVelocity(); }
+	FVector GetAcceleration(int32 Index) const { return Samples[ToPhysical(Index)].GetAcceleration(); }
+	FRotator GetControllerRotation(int32 Index) const { return Samples[ToPhysical(Index)].GetControllerRotation(); }
+
+	/// This sample's transform relative to the newest sample.
+	FTransform GetRelativeTransform(int32 Index) const;
+
+	/// This sample's velocity in the newest sample's frame of reference.
+	FVector GetRelativeLinearVelocity(int32 Index) const;
+
+	/// Equivalent to GetSample(Index).IsZeroSample(), without building the sample.
+	bool IsZeroSample(int32 Index) const;
+
+private:
+
+	int32 ToPhysical(int32 Index) const
+	{
+		checkSlow(IsValidIndex(Index));
+		const int32 Physical = Head + Index;
+		return Physical >= Capacity ? Physical - Capacity : Physical;
+	}
+
+	/// Move the origin to the given location if it's far enough away that sample precision would suffer.
+	void RebaseIfNeeded(const FVector& Location);
+
+	/// Drop the sample at the given index if it can be interpolated from the samples either side of it.
+	bool TryDropKeyframe(int32 Index, const FGMCE_MovementHistoryTolerances& Tolerances);
+
+	int32 Head { 0 };
+	int32 Count { 0 };
+	int32 Capacity { 0 };
+
+	/// World location the stored sample locations are relative to.
+	FVector Origin { FVector::ZeroVector };
+
+	FGMCE_CompactMovementSampleArray Samples;
+
+	// Samples dropped by keyframe reduction since the last kept keyframe; new spans are checked against them too,
+	// so that error can't build up over a long run of drops.
+	FGMCE_CompactMovementSampleArray ReducedSamples;
+
+	/// Game time of the newest sample keyframe reduction has considered.
+	float ReducedThroughSeconds { TNumericLimits<float>::Lowest() };
+};
+
+/// Non-owning, read-only view over a movement history. Cheap to copy and pass around; it must not outlive the
+/// history it was made from.
+struct GMCEXTENDED_API FGMCE_MovementHistoryView
+{
+	explicit FGMCE_MovementHistoryView(const FGMCE_MovementHistory& InHistory) : History(&InHistory) {}
+
+	int32 Num() const { return History->Num(); }
+	bool IsEmpty() const { return History->IsEmpty(); }
+	const FGMCE_MovementHistory& operator*() const { return *History; }
+	const FGMCE_MovementHistory* operator->() const { return History; }
+
+	/// Walks logical indices in either direction. Dereferencing yields the index, to be used with the history's
+	/// field accessors so that only the fields needed are read.
+	struct FIterator
+	{
+		int32 Index;
+		int32 Step;
+
+		int32 operator*() const { return Index; }
+		FIterator& operator++() { Index += Step; return *this; }
+		bool operator!=(const FIterator& Other) const { return Index != Other.Index; }
+	};
+
+	struct FRange
+	{
+		FIterator First;
+		FIterator Last;
+
+		FIterator begin() const { return First; }
+		FIterator end() const { return Last; }
+	};
+
+	/// Oldest to newest.
+	FIterator begin() const { return { 0, 1 }; }
+	FIterator end() const { return { Num(), 1 }; }
+
+	/// Newest to oldest.
+	FRange Reverse() const { return { { Num() - 1, -1 }, { -1, -1 } }; }
+
+	/// Index of the first sample whose accumulated seconds are at or after the given time, or Num() if there is none.
+	int32 LowerBound(float AccumulatedSeconds) const;
+
+	/// Index of the newest sample whose accumulated seconds are at or before the given time, or INDEX_NONE if
+	/// there is none.
+	int32 FindLastAtOrBefore(float AccumulatedSeconds) const;
+
+	/// Build full samples for the history and append them to an array, oldest first.
+	void AppendTo(TArray<FGMCE_MovementSample>& OutSamples, bool bOmitLatest = false) const;
+
+private:
+
+	const FGMCE_MovementHistory* History;
+};
@@ -287,6 +287,23 @@ struct GMCEXTENDED_API FGMCE_MovementSampleCollection
 		return FGMCE_MovementSample();		
 	}
 
+	/// Batched GetSampleAtTime: appends one sample per query time, in order, giving the same results as calling
+	/// GetSampleAtTime for each. Ascending times are resolved in a single forward sweep rather than a search each.
+	void GetSamplesAtTimes(TConstArrayView<float> Times, bool bExtrapolate, TArray<FGMCE_MovementSample>& OutSamples) const;
+
+	/// As GetSamplesAtTimes, but only interpolates world location and rotation, for callers which only need
+	/// position and facing.
+	void GetWorldTransformsAtTimes(TConstArrayView<float> Times, bool bExtrapolate, TArray<FTransform>& OutTransforms) const;
+
+	/// Write these samples into an existing pose search trajectory, replacing its contents but keeping its
+	/// allocation. Cheaper than the conversion operator when the same trajectory is reused every update.
+	void ExportToPoseSearchQueryTrajectory(FPoseSearchQueryTrajectory& OutTrajectory) const;
+
+	/// As above, but resampled to the given times (in accumulated seconds) rather than copying every sample; for
+	/// instance, the sample times a pose search schema asks for. Times outside the collection are clamped to its
+	/// ends. Ascending times are resolved in a single pass.
+	void ExportToPoseSearchQueryTrajectory(FPoseSearchQueryTrajectory& OutTrajectory, TConstArrayView<float> SampleTimes) const;
+
 	bool HasMovementInRange(float MinTime, float MaxTime) const
 	{
 		for (const auto& Sample : Samples)
@@ -334,5 +351,54 @@ struct GMCEXTENDED_API FGMCE_MovementSampleCollection
 
 	// Re-enable deprecation warnings
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
-	
+
+private:
+
+	/// Walk the query times, calling Visit(Time, PrevIdx, NextIdx, Alpha) with the samples to interpolate between
+	/// for each; PrevIdx == NextIdx when the time resolves to a single sample. The collection must not be empty.
+	template<typename VisitorType>
+	void SweepTimes(TConstArrayView<float> Times, bool bExtrapolate, VisitorType&& Visit) const
+	{
+		const int32 Num = Samples.Num();
+		int32 NextIdx = 1;
+		float PreviousTime = -UE_BIG_NUMBER;
+
+		for (const float Time : Times)
+		{
+			if (Time < PreviousTime)
+			{
+				// Out of order; start the sweep over.
+				NextIdx = 1;
+			}
+			PreviousTime = Time;
+
+			if (Num == 1 || Time < Samples[0].AccumulatedSeconds)
+			{
+				Visit(Time, 0, 0, 0.f);
+				continue;
+			}
+
+			if (Time > Samples.Last().AccumulatedSeconds)
+			{
+				Visit(Time, Num - 1, Num - 1, 0.f);
+				continue;
+			}
+
+			while (NextIdx < Num - 1 && Samples[NextIdx].AccumulatedSeconds < Time)
+			{
+				NextIdx++;
+			}
+
+			const int32 PrevIdx = NextIdx - 1;
+			const float Denominator = Samples[NextIdx].AccumulatedSeconds - Samples[PrevIdx].AccumulatedSeconds;
+			if (FMath::IsNearlyZero(Denominator))
+			{
+				Visit(Time, PrevIdx, PrevIdx, 0.f);
+				continue;
+			}
+
+			const float Alpha = (Time - Samples[PrevIdx].AccumulatedSeconds) / Denominator;
+			Visit(Time, PrevIdx, NextIdx, bExtrapolate ? Alpha : FMath::Clamp(Alpha, 0.f, 1.f));
+		}
+	}
 };
\ No newline at end of file
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/HitResult.h"
+#include "GMCOrganicMovementComponent.h"
+#include "Support/GMCEMovementSample.h"
+
+/// Everything the trajectory integrator needs, gathered from the movement component up front so that the
+/// integration loop never goes back to the component; predictions can then run off the game thread.
+struct GMCEXTENDED_API FGMCE_TrajectoryPredictionInput
+{
+	FTransform Origin { FTransform::Identity };
+	FRotator ControllerRotation { FRotator::ZeroRotator };
+	FRotator MeshOffsetRotation { FRotator::ZeroRotator };
+
+	float TimePerSample { 0.f };
+	int32 NumSamples { 0 };
+
+	FVector InitialVelocity { 0.f };
+	FVector InitialAcceleration { 0.f };
+	FVector Gravity { 0.f };
+
+	/// Per-sample rotation steps, each decayed as the prediction goes on.
+	FRotator RotationVelocityPerSample { FRotator::ZeroRotator };
+	FRotator ControllerRotationVelocityPerSample { FRotator::ZeroRotator };
+	FRotator MeshOffsetRotationVelocityPerSample { FRotator::ZeroRotator };
+	FRotator AccelerationRotation { FRotator::ZeroRotator };
+
+	/// Divisor applied to the acceleration rotation's yaw after each sample; 1 for no decay.
+	float AccelerationRotationDecay { 1.f };
+
+	EGMC_MovementMode MovementMode { EGMC_MovementMode::Grounded };
+	float BrakingDeceleration { 0.f };
+
+	/// Braking is never weaker than this, as with the movement component's own deceleration.
+	float MinDeceleration { 0.f };
+
+	float BrakingFriction { 0.f };
+	float GroundFriction { 0.f };
+	float MaxSpeed { 0.f };
+	float InputAcceleration { 0.f };
+	float MaxTimeStep { 0.f };
+	float MaxGroundedVelocityZ { 0.f };
+	float MaxStepUpHeight { 0.f };
+	float MaxStepDownHeight { 0.f };
+
+	bool bInputPresent { false };
+
+	/// The controller already faces where it's predicted to; acceleration and controller rotation stop after the
+	/// first sample.
+	bool bStopAtControllerRotation { false };
+
+	bool bPredictCollisions { false };
+
+	/// If set, ground probes aren't traced during integration; instead GroundHits holds the results of the previous
+	/// prediction's probes, by sample index, and only the height of each hit is used.
+	bool bAsyncCollisions { false };
+	TConstArrayView<TOptional<FHitResult>> GroundHits;
+
+	/// Where synchronous ground probes are traced, and what they ignore. Only set when collisions are predicted
+	/// without async probes, which keeps the prediction on the game thread.
+	const UWorld* TraceWorld { nullptr };
+	const AActor* TraceIgnoredActor { nullptr };
+
+	/// Whether integrating this input would give the same result as integrating the other one, give or take where it
+	/// starts from. Integration doesn't depend on location, and rotations are only ever offset by their starting
+	/// yaw, so a pawn moving steadily keeps producing the same relative prediction. Collision prediction depends on
+	/// the world around the pawn, so it is never reusable.
+	bool CanReuseIntegrationFrom(const FGMCE_TrajectoryPredictionInput& Other, float VelocityTolerance) const;
+};
+
+/// Packed per-sample results of a trajectory prediction, one float array per component. Locations are stored as
+/// offsets from the prediction origin, which keeps them small enough for single precision.
+///
+/// The integrator fills in the world-space arrays one sample at a time; TransformToOriginSpace then converts the
+/// whole batch into the origin's frame four samples at a time, and AppendSamples builds the final
+/// FGMCE_MovementSample structs once everything else is done.
+struct GMCEXTENDED_API FGMCE_TrajectoryPredictionBuffers
+{
+	int32 Num() const { return NumSamples; }
+
+	/// Size every array for the given number of samples, padded out to a whole number of SIMD lanes.
+	void Reset(int32 InNumSamples);
+
+	void SetSample(int32 Index, const FVector& Offset, const FVector& Velocity, const FVector& Acceleration,
+		float Yaw, float ControllerYaw, float MeshOffsetYaw, bool bMarker);
+
+	/// Rotate already-integrated results about their yaw, for reuse from a new starting rotation.
+	void OffsetYaw(float YawDelta, float ControllerYawDelta);
+
+	/// Record the ground probe segment for a sample, so it can be traced later.
+	void SetProbe(int32 Index, const FVector& Start, const FVector& End);
+
+	/// Fill in the origin-relative offset and velocity arrays from the world-space ones.
+	void TransformToOriginSpace(const FTransform& Origin);
+
+	/// Build movement samples from the packed arrays and append them to the output.
+	void AppendSamples(const FGMCE_TrajectoryPredictionInput& Input, TArray<FGMCE_MovementSample>& OutSamples) const;
+
+	TArray<float> OffsetX;
+	TArray<float> OffsetY;
+	TArray<float> OffsetZ;
+	TArray<float> VelocityX;
+	TArray<float> VelocityY;
+	TArray<float> VelocityZ;
+	TArray<float> AccelerationX;
+	TArray<float> AccelerationY;
+	TArray<float> AccelerationZ;
+	TArray<float> Yaw;
+	TArray<float> ControllerYaw;
+	TArray<float> MeshOffsetYaw;
+	TBitArray<> Markers;
+
+	/// Ground probe segments, in world space. Only filled in when predicting collisions.
+	TArray<FVector> ProbeStarts;
+	TArray<FVector> ProbeEnds;
+
+	TArray<float> RelativeOffsetX;
+	TArray<float> RelativeOffsetY;
+	TArray<float> RelativeOffsetZ;
+	TArray<float> RelativeVelocityX;
+	TArray<float> RelativeVelocityY;
+	TArray<float> RelativeVelocityZ;
+
+private:
+
+	int32 NumSamples { 0 };
+};
@@ -0,0 +1,59 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Support/GMCEMovementSample.h"
+#include "Support/GMCETrajectoryPrediction.h"
+#include "GMCE_TrajectorySubsystem.generated.h"
+
+class UGMCE_OrganicMovementCmp;
+
+/**
+ * @brief Runs trajectory prediction for every registered organic movement component in one parallel batch.
+ *
+ * Components opt in with bPredictTrajectoryInParallel. During their own tick they only mark themselves as wanting
+ * a prediction; at the end of the frame the subsystem gathers each one's input on the game thread, runs all of
+ * the predictions across worker threads, and then writes the results back to PredictedTrajectory.
+ *
+ * It also gathers where every viewer is looking from, once per frame, for components scaling their trajectories
+ * by significance.
+ */
+UCLASS()
+class GMCEXTENDED_API UGMCE_TrajectorySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	void RegisterComponent(UGMCE_OrganicMovementCmp* Component);
+	void UnregisterComponent(UGMCE_OrganicMovementCmp* Component);
+
+	/// Where everyone who might be watching views from this frame: each local player's camera, and on a server,
+	/// each remote player's pawn. Gathered on the first call each frame; later calls reuse it.
+	const TArray<FVector>& GetViewerLocations();
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	struct FPredictionJob
+	{
+		UGMCE_OrganicMovementCmp* Component { nullptr };
+		FGMCE_TrajectoryPredictionInput Input;
+		bool bQueueGroundTraces { false };
+		FGMCE_MovementSampleCollection Result;
+	};
+
+	TArray<TWeakObjectPtr<UGMCE_OrganicMovementCmp>> Components;
+
+	TArray<FVector> ViewerLocations;
+	uint64 ViewerLocationsFrame { MAX_uint64 };
+
+	/// Kept between frames so that the result arrays don't need reallocating.
+	TArray<FPredictionJob> Jobs;
+};
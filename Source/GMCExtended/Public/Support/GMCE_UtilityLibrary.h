@@ -48,6 +48,12 @@ public:
 	UFUNCTION(BlueprintPure, Category="Movement Trajectory")
 	static FPoseSearchQueryTrajectory ConvertMovementSampleCollectionToPoseSearchQueryTrajectory(const FGMCE_MovementSampleCollection& MovementSampleCollection);
 
+	/// Writes a GMCEx Movement Sample Collection into an existing Epic Pose Search Query Trajectory, reusing its
+	/// storage rather than building a new one. If any sample times are given, the collection is resampled to them.
+	UFUNCTION(BlueprintCallable, Category="Movement Trajectory")
+	static void ExportMovementSampleCollectionToPoseSearchQueryTrajectory(const FGMCE_MovementSampleCollection& MovementSampleCollection,
+		UPARAM(ref) FPoseSearchQueryTrajectory& Trajectory, const TArray<float>& SampleTimes);
+
 	/// Get the server's RealTimeSeconds, as synchronized by GMC.
 	UFUNCTION(BlueprintPure, Category="Time")
 	static float GetSynchronizedWorldTime(UObject *WorldContextObject);